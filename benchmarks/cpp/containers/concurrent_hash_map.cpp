@@ -0,0 +1,145 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <bench.hpp>
+
+#include <auxid/containers/concurrent_hash_map.hpp>
+#include <auxid/thread/thread.hpp>
+
+#include <atomic>
+
+using namespace au;
+
+// Usage: BenchConcurrentHashMap [max_threads=64] [keys=1000000] [ops_per_thread=2000000]
+//   Reports aggregate throughput (all threads) for read:write mixes of 100:0, 95:5, 80:20 and 50:50.
+//   Writes alternate between erase and re-insert of the same key so the size stays stable.
+
+// Baseline: what sharing a HashMap looked like before, one Mutex around the whole table.
+class MutexHashMap
+{
+  mutable Mutex m_mutex;
+  HashMap<u64, u64> m_map;
+
+public:
+  auto insert(u64 key, u64 val) -> bool
+  {
+    LockGuard<Mutex> lock(m_mutex);
+    return m_map.insert(key, val);
+  }
+
+  auto erase(u64 key) -> bool
+  {
+    LockGuard<Mutex> lock(m_mutex);
+    return m_map.erase(key);
+  }
+
+  auto contains(u64 key) const -> bool
+  {
+    LockGuard<Mutex> lock(m_mutex);
+    return const_cast<HashMap<u64, u64> &>(m_map).contains(key);
+  }
+};
+
+template<typename MapT>
+auto run_mix(const char *label, MapT &map, const Vec<u64> &keys, u32 threads, u32 write_percent, usize ops_per_thread)
+    -> void
+{
+  std::atomic<u32> ready{0};
+  std::atomic<bool> go{false};
+  std::atomic<u64> hits{0};
+
+  bench::Timer timer;
+  {
+    Vec<JThread> workers;
+    for (u32 t = 0; t < threads; ++t)
+    {
+      workers.push(JThread::create([&, t]() {
+                     bench::Rng rng(0x1234 + t);
+                     u64 local_hits = 0;
+
+                     ready.fetch_add(1, std::memory_order_acq_rel);
+                     while (!go.load(std::memory_order_acquire))
+                       compiler::cpu_relax();
+
+                     for (usize i = 0; i < ops_per_thread; ++i)
+                     {
+                       const u64 r = rng.next();
+                       const u64 key = keys[r % keys.size()];
+                       if ((r >> 32) % 100 < write_percent)
+                       {
+                         if (!map.erase(key))
+                           map.insert(key, i);
+                       }
+                       else
+                       {
+                         local_hits += map.contains(key);
+                       }
+                     }
+                     hits.fetch_add(local_hits, std::memory_order_relaxed);
+                   }).unwrap());
+    }
+
+    while (ready.load(std::memory_order_acquire) != threads)
+      compiler::cpu_relax();
+    timer.reset();
+    go.store(true, std::memory_order_release);
+  }
+  const f64 elapsed = timer.elapsed_ns();
+  bench::do_not_optimize(hits.load());
+
+  char name[64];
+  snprintf(name, sizeof(name), "%s/w%u/t%u", label, write_percent, threads);
+  bench::report(name, keys.size(), ops_per_thread * threads, elapsed);
+}
+
+auto main(int argc, char *argv[]) -> int
+{
+  auxid::MainThreadGuard _main_thread_guard;
+
+  const u32 max_threads = static_cast<u32>(bench::arg_or(argc, argv, 1, 64));
+  const usize n = bench::arg_or(argc, argv, 2, 1000000);
+  const usize ops = bench::arg_or(argc, argv, 3, 2000000);
+
+  bench::Rng rng;
+  Vec<u64> keys;
+  keys.reserve(n);
+  for (usize i = 0; i < n; ++i)
+    keys.push(rng.next());
+
+  const u32 write_mixes[] = {0, 5, 20, 50};
+
+  for (const u32 write_percent : write_mixes)
+  {
+    for (u32 threads = 1; threads <= max_threads; threads *= 2)
+    {
+      {
+        ConcurrentHashMap<u64, u64> map;
+        map.reserve(n);
+        for (usize i = 0; i < n; ++i)
+          map.insert(keys[i], i);
+        run_mix("concurrent", map, keys, threads, write_percent, ops);
+      }
+      {
+        MutexHashMap map;
+        for (usize i = 0; i < n; ++i)
+          map.insert(keys[i], i);
+        run_mix("mutex", map, keys, threads, write_percent, ops);
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,76 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <bench.hpp>
+
+#include <auxid/containers/frozen_hash_map.hpp>
+#include <auxid/containers/hash_map.hpp>
+#include <auxid/std_wrappers/filesystem.hpp>
+
+using namespace au;
+
+// Usage: BenchFrozenHashMap [n=10000000]
+//   Compares rebuilding a HashMap<u64, u64> at startup with opening a frozen image of it,
+//   then the lookup speed of both.
+
+auto main(int argc, char *argv[]) -> int
+{
+  auxid::MainThreadGuard _main_thread_guard;
+
+  const usize n = bench::arg_or(argc, argv, 1, 10000000);
+
+  bench::Rng rng;
+  Vec<Pair<u64, u64>> items;
+  items.reserve(n);
+  for (usize i = 0; i < n; ++i)
+    items.push({rng.next(), i});
+
+  const filesystem::Path path = filesystem::temp_directory_path().unwrap() / "auxid_bench_frozen.bin";
+
+  bench::Timer timer;
+  auto map = HashMap<u64, u64>::from_unique(items);
+  bench::report("startup/rebuild_from_unique", n, 1, timer.elapsed_ns());
+
+  timer.reset();
+  FrozenHashMap<u64, u64>::write(path.string().c_str(), map).unwrap();
+  bench::report("startup/write_image", n, 1, timer.elapsed_ns());
+
+  timer.reset();
+  auto frozen = FrozenHashMap<u64, u64>::open(path.string().c_str()).unwrap();
+  bench::report("startup/open_image", n, 1, timer.elapsed_ns());
+
+  const usize queries = n < 1000000 ? 1000000 : n;
+  u64 sum = 0;
+
+  timer.reset();
+  for (usize i = 0; i < queries; ++i)
+    sum += *frozen.find(items[rng.next() % n].first);
+  bench::report("frozen/find_hit (first touch)", n, queries, timer.elapsed_ns());
+
+  timer.reset();
+  for (usize i = 0; i < queries; ++i)
+    sum += *frozen.find(items[rng.next() % n].first);
+  bench::report("frozen/find_hit", n, queries, timer.elapsed_ns());
+
+  timer.reset();
+  for (usize i = 0; i < queries; ++i)
+    sum += *map.find(items[rng.next() % n].first);
+  bench::report("hash_map/find_hit", n, queries, timer.elapsed_ns());
+
+  bench::do_not_optimize(sum);
+  AU_UNUSED(filesystem::remove(path));
+  return 0;
+}
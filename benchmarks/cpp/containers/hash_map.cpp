@@ -0,0 +1,150 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <bench.hpp>
+#include <legacy_hash_map.hpp>
+
+#include <auxid/containers/hash_map.hpp>
+
+using namespace au;
+
+// Usage: BenchHashMap [max_exponent=7]
+//   Runs every workload at 10^3 .. 10^max_exponent entries (10^8 needs ~8GB of RAM).
+
+template<typename MapT> auto run_workloads(const char *label, const Vec<u64> &keys, const Vec<u64> &queries) -> void
+{
+  char name[64];
+  const usize n = keys.size();
+
+  bench::Timer timer;
+  MapT map;
+  for (usize i = 0; i < n; ++i)
+    map.insert(keys[i], i);
+  snprintf(name, sizeof(name), "%s/insert", label);
+  bench::report(name, n, n, timer.elapsed_ns());
+
+  u64 sum = 0;
+  timer.reset();
+  for (usize i = 0; i < queries.size(); ++i)
+    sum += *map.find(keys[queries[i]]);
+  bench::do_not_optimize(sum);
+  snprintf(name, sizeof(name), "%s/find_hit", label);
+  bench::report(name, n, queries.size(), timer.elapsed_ns());
+
+  usize misses = 0;
+  timer.reset();
+  for (usize i = 0; i < queries.size(); ++i)
+    misses += map.find(~keys[queries[i]]) == nullptr;
+  bench::do_not_optimize(misses);
+  snprintf(name, sizeof(name), "%s/find_miss", label);
+  bench::report(name, n, queries.size(), timer.elapsed_ns());
+
+  timer.reset();
+  for (usize i = 0; i < n; i += 2)
+    map.erase(keys[i]);
+  snprintf(name, sizeof(name), "%s/erase_half", label);
+  bench::report(name, n, n / 2, timer.elapsed_ns());
+}
+
+// Grows from empty with String keys, so every rehash re-reads the keys unless hashes are cached.
+template<typename MapT> auto run_string_growth(const char *label, const Vec<String> &keys) -> void
+{
+  char name[64];
+
+  bench::Timer timer;
+  MapT map;
+  for (usize i = 0; i < keys.size(); ++i)
+    map.insert(keys[i], i);
+  snprintf(name, sizeof(name), "%s/string_grow", label);
+  bench::report(name, keys.size(), keys.size(), timer.elapsed_ns());
+
+  timer.reset();
+  for (usize i = 0; i < keys.size(); i += 2)
+    map.erase(keys[i]);
+  snprintf(name, sizeof(name), "%s/string_erase_half", label);
+  bench::report(name, keys.size(), keys.size() / 2, timer.elapsed_ns());
+}
+
+// Cold build of a table from a prepared array: per-element insert vs. the batch APIs.
+auto run_bulk_build(const Vec<u64> &keys) -> void
+{
+  Vec<Pair<u64, u64>> items;
+  items.reserve(keys.size());
+  for (usize i = 0; i < keys.size(); ++i)
+    items.push({keys[i], i});
+
+  bench::Timer timer;
+  {
+    HashMap<u64, u64> map;
+    for (const auto &item : items)
+      map.insert(item.first, item.second);
+    bench::do_not_optimize(map.size());
+  }
+  bench::report("ctrl_groups/build_insert_loop", keys.size(), keys.size(), timer.elapsed_ns());
+
+  timer.reset();
+  {
+    auto map = HashMap<u64, u64>::build(items);
+    bench::do_not_optimize(map.size());
+  }
+  bench::report("ctrl_groups/build_insert_many", keys.size(), keys.size(), timer.elapsed_ns());
+
+  timer.reset();
+  {
+    auto map = HashMap<u64, u64>::from_unique(items);
+    bench::do_not_optimize(map.size());
+  }
+  bench::report("ctrl_groups/build_from_unique", keys.size(), keys.size(), timer.elapsed_ns());
+}
+
+auto main(int argc, char *argv[]) -> int
+{
+  auxid::MainThreadGuard _main_thread_guard;
+
+  const u64 max_exponent = bench::arg_or(argc, argv, 1, 7);
+
+  usize n = 1000;
+  for (u64 e = 3; e <= max_exponent; ++e, n *= 10)
+  {
+    bench::Rng rng(e);
+
+    Vec<u64> keys;
+    keys.reserve(n);
+    for (usize i = 0; i < n; ++i)
+      keys.push(rng.next() | 1);
+
+    const usize query_count = n < 1000000 ? 1000000 : n;
+    Vec<u64> queries;
+    queries.reserve(query_count);
+    for (usize i = 0; i < query_count; ++i)
+      queries.push(rng.next() % n);
+
+    run_workloads<bench::LegacyHashMap<u64, u64>>("legacy_linear", keys, queries);
+    run_workloads<HashMap<u64, u64>>("ctrl_groups", keys, queries);
+    run_bulk_build(keys);
+
+    Vec<String> string_keys;
+    string_keys.reserve(n);
+    for (usize i = 0; i < n; ++i)
+      string_keys.push(String::format("/api/v1/resources/%016llx", static_cast<unsigned long long>(keys[i])));
+
+    run_string_growth<HashMap<String, usize>>("ctrl_groups", string_keys);
+    run_string_growth<CachedHashMap<String, usize>>("ctrl_groups_cached", string_keys);
+    putchar('\n');
+  }
+
+  return 0;
+}
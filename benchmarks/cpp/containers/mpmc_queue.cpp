@@ -0,0 +1,170 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <bench.hpp>
+
+#include <auxid/containers/mpmc_queue.hpp>
+#include <auxid/containers/vec.hpp>
+#include <auxid/thread/mutex.hpp>
+#include <auxid/thread/thread.hpp>
+
+#include <atomic>
+
+using namespace au;
+
+// Usage: BenchMpmcQueue [threads=8] [jobs=4000000]
+//   Job dispatch: threads/2 producers hand `jobs` u64 job ids to threads/2 consumers
+//   through a 1024-slot queue. Compares a Mutex-guarded ring with DynamicMpmcQueue,
+//   moving one job per operation and batches of 16. Only meaningful with at least
+//   `threads` cores.
+
+class MutexQueue
+{
+  Mutex m_mutex;
+  Vec<u64> m_slots;
+  usize m_head = 0;
+  usize m_tail = 0;
+
+public:
+  explicit MutexQueue(usize capacity)
+  {
+    m_slots.resize(capacity, 0);
+  }
+
+  bool try_push(u64 value)
+  {
+    LockGuard<Mutex> lock(m_mutex);
+    if (m_tail - m_head == m_slots.size())
+      return false;
+    m_slots[m_tail++ % m_slots.size()] = value;
+    return true;
+  }
+
+  bool try_pop(u64 &out_value)
+  {
+    LockGuard<Mutex> lock(m_mutex);
+    if (m_head == m_tail)
+      return false;
+    out_value = m_slots[m_head++ % m_slots.size()];
+    return true;
+  }
+};
+
+template<typename PushFn, typename PopFn>
+auto run(const char *name, usize threads, usize jobs, PushFn push, PopFn pop) -> void
+{
+  const usize producers = threads / 2 > 0 ? threads / 2 : 1;
+  const usize consumers = threads - producers > 0 ? threads - producers : 1;
+  const usize per_producer = jobs / producers;
+  const usize total = per_producer * producers;
+  std::atomic<usize> done{0};
+  std::atomic<u64> checksum{0};
+
+  const auto producer = [&](usize p) {
+    usize next = 0;
+    while (next < per_producer)
+    {
+      const usize n = push(p * per_producer + next, per_producer - next);
+      next += n;
+      // Back off when full, so oversubscribed runs do not spin away whole time slices.
+      if (n == 0)
+        thrd_yield();
+    }
+  };
+
+  const auto consumer = [&]() {
+    u64 sum = 0;
+    while (done.load(std::memory_order_relaxed) < total)
+    {
+      const usize n = pop(sum);
+      if (n)
+        done.fetch_add(n, std::memory_order_relaxed);
+      else
+        thrd_yield();
+    }
+    checksum.fetch_add(sum, std::memory_order_relaxed);
+  };
+
+  bench::Timer timer;
+  Vec<Thread> workers;
+  for (usize p = 0; p < producers; ++p)
+    workers.push(std::move(Thread::create(producer, p).unwrap()));
+  for (usize c = 0; c < consumers; ++c)
+    workers.push(std::move(Thread::create(consumer).unwrap()));
+  for (Thread &t : workers)
+    t.join();
+
+  bench::do_not_optimize(checksum.load());
+  bench::report(name, threads, total, timer.elapsed_ns());
+}
+
+auto main(int argc, char *argv[]) -> int
+{
+  auxid::MainThreadGuard _main_thread_guard;
+
+  const usize threads = bench::arg_or(argc, argv, 1, 8);
+  const usize jobs = bench::arg_or(argc, argv, 2, 4000000);
+  constexpr usize CAPACITY = 1024;
+  constexpr usize BATCH = 16;
+
+  {
+    MutexQueue queue(CAPACITY);
+    run(
+        "mutex/single", threads, jobs, [&](u64 job, usize) -> usize { return queue.try_push(job) ? 1 : 0; },
+        [&](u64 &sum) -> usize {
+          u64 job;
+          if (!queue.try_pop(job))
+            return 0;
+          sum += job;
+          return 1;
+        });
+  }
+
+  {
+    auto queue = DynamicMpmcQueue<u64>::create(CAPACITY).unwrap();
+    run(
+        "mpmc/single", threads, jobs, [&](u64 job, usize) -> usize { return queue.try_push(job) ? 1 : 0; },
+        [&](u64 &sum) -> usize {
+          u64 job;
+          if (!queue.try_pop(job))
+            return 0;
+          sum += job;
+          return 1;
+        });
+  }
+
+  {
+    auto queue = DynamicMpmcQueue<u64>::create(CAPACITY).unwrap();
+    run(
+        "mpmc/batch16", threads, jobs,
+        [&](u64 first_job, usize remaining) -> usize {
+          u64 batch[BATCH];
+          const usize count = remaining < BATCH ? remaining : BATCH;
+          for (usize i = 0; i < count; ++i)
+            batch[i] = first_job + i;
+          return queue.try_push_bulk(Span<u64>(batch, count));
+        },
+        [&](u64 &sum) -> usize {
+          u64 batch[BATCH];
+          const usize n = queue.try_pop_bulk(Span<u64>(batch, BATCH));
+          for (usize i = 0; i < n; ++i)
+            sum += batch[i];
+          return n;
+        });
+  }
+
+  return 0;
+}
@@ -0,0 +1,96 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <bench.hpp>
+
+#include <auxid/containers/ring_buffer.hpp>
+
+using namespace au;
+
+// Usage: BenchRingBuffer [payload_bytes=256] [packets=5000000]
+//   Single thread: serializes `payload_bytes` into a packet and parses it back, through
+//   push/pop (a staging buffer on each side, copied in and out) and through
+//   reserve/commit/peek/release (written and read in place in the mirrored region).
+
+// Stand-ins for a serializer and a parser working on a byte range of whole u64 words.
+static auto serialize(u8 *out, u32 size, u64 seed) -> void
+{
+  for (u32 i = 0; i + 8 <= size; i += 8)
+  {
+    const u64 word = seed + i;
+    std::memcpy(out + i, &word, 8);
+  }
+}
+
+static auto parse(const u8 *in, u32 size) -> u64
+{
+  u64 sum = 0;
+  for (u32 i = 0; i + 8 <= size; i += 8)
+  {
+    u64 word;
+    std::memcpy(&word, in + i, 8);
+    sum += word;
+  }
+  return sum;
+}
+
+auto main(int argc, char *argv[]) -> int
+{
+  auxid::MainThreadGuard _main_thread_guard;
+
+  const u32 payload = static_cast<u32>(bench::arg_or(argc, argv, 1, 256));
+  const usize packets = bench::arg_or(argc, argv, 2, 5000000);
+  constexpr u32 CAPACITY = 1 << 16;
+
+  {
+    auto ring = containers::DynamicRingBuffer::create(CAPACITY).unwrap();
+    u8 staging_out[65536];
+    u8 staging_in[65536];
+    containers::PacketHeader header;
+    u64 sum = 0;
+
+    bench::Timer timer;
+    for (usize i = 0; i < packets; ++i)
+    {
+      serialize(staging_out, payload, i);
+      (void) ring.push(1, Span<const u8>(staging_out, payload));
+      (void) ring.pop(header, Span<u8>(staging_in, sizeof(staging_in)));
+      sum += parse(staging_in, header.payload_size);
+    }
+    bench::do_not_optimize(sum);
+    bench::report_bytes("ring/push_pop_copy", payload, packets, timer.elapsed_ns());
+  }
+
+  {
+    auto ring = containers::DynamicRingBuffer::create(CAPACITY).unwrap();
+    u64 sum = 0;
+
+    bench::Timer timer;
+    for (usize i = 0; i < packets; ++i)
+    {
+      auto span = ring.reserve(1, payload).unwrap();
+      serialize(span.data(), payload, i);
+      (void) ring.commit(payload);
+      auto packet = ring.peek();
+      sum += parse(packet->payload.data(), packet->header.payload_size);
+      (void) ring.release();
+    }
+    bench::do_not_optimize(sum);
+    bench::report_bytes("ring/reserve_peek_in_place", payload, packets, timer.elapsed_ns());
+  }
+
+  return 0;
+}
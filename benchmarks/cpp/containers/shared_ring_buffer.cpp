@@ -0,0 +1,146 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <bench.hpp>
+
+#include <auxid/containers/shared_ring_buffer.hpp>
+
+#if !defined(_WIN32)
+#  include <sched.h>
+#  include <sys/socket.h>
+#  include <sys/wait.h>
+#  include <unistd.h>
+#endif
+
+using namespace au;
+
+// Usage: BenchSharedRingBuffer [payload_bytes=64] [packets=1000000]
+//   Telemetry between two processes: a forked child sends `packets` packets of
+//   `payload_bytes` to the parent, over a SOCK_SEQPACKET Unix socket pair (one write and
+//   one read syscall per packet) and over a SharedRingBuffer (serialized and parsed in
+//   place, no syscalls while data flows). Reports parent-side wall time per packet.
+//   POSIX only.
+
+#if !defined(_WIN32)
+static auto fill(u8 *out, u32 size, u32 seq) -> void
+{
+  for (u32 i = 0; i < size; ++i)
+    out[i] = static_cast<u8>(seq + i);
+}
+
+static auto bench_socket(u32 payload, usize packets) -> void
+{
+  int fds[2];
+  if (socketpair(AF_UNIX, SOCK_SEQPACKET, 0, fds) != 0)
+  {
+    printf("socketpair failed\n");
+    return;
+  }
+
+  bench::Timer timer;
+  const pid_t child = fork();
+  if (child == 0)
+  {
+    close(fds[0]);
+    u8 buffer[65536];
+    for (usize i = 0; i < packets; ++i)
+    {
+      fill(buffer, payload, static_cast<u32>(i));
+      if (write(fds[1], buffer, payload) != static_cast<ssize_t>(payload))
+        _exit(1);
+    }
+    _exit(0);
+  }
+  close(fds[1]);
+
+  u8 buffer[65536];
+  u64 sum = 0;
+  for (usize i = 0; i < packets; ++i)
+  {
+    const ssize_t n = read(fds[0], buffer, sizeof(buffer));
+    if (n <= 0)
+      break;
+    sum += buffer[0];
+  }
+  waitpid(child, nullptr, 0);
+  close(fds[0]);
+
+  bench::do_not_optimize(sum);
+  bench::report_bytes("ipc/unix_seqpacket", payload, packets, timer.elapsed_ns());
+}
+
+static auto bench_shared_ring(u32 payload, usize packets) -> void
+{
+  auto ring = std::move(containers::SharedRingBuffer::create_anonymous(1 << 20).unwrap());
+
+  bench::Timer timer;
+  const pid_t child = fork();
+  if (child == 0)
+  {
+    auto producer = std::move(containers::SharedRingBuffer::open_fd(ring.fd()).unwrap());
+    for (usize i = 0; i < packets;)
+    {
+      auto span = producer.reserve(1, payload);
+      if (!span.is_ok())
+      {
+        sched_yield();
+        continue;
+      }
+      fill(span.unwrap().data(), payload, static_cast<u32>(i));
+      (void) producer.commit(payload);
+      i++;
+    }
+    _exit(0);
+  }
+
+  u64 sum = 0;
+  for (usize i = 0; i < packets;)
+  {
+    auto packet = ring.peek();
+    if (packet.is_none())
+    {
+      sched_yield();
+      continue;
+    }
+    sum += packet->payload[0];
+    (void) ring.release();
+    i++;
+  }
+  waitpid(child, nullptr, 0);
+
+  bench::do_not_optimize(sum);
+  bench::report_bytes("ipc/shared_ring", payload, packets, timer.elapsed_ns());
+}
+#endif
+
+auto main(int argc, char *argv[]) -> int
+{
+  auxid::MainThreadGuard _main_thread_guard;
+
+#if defined(_WIN32)
+  (void) argc;
+  (void) argv;
+  printf("BenchSharedRingBuffer: POSIX only\n");
+#else
+  const u32 payload = static_cast<u32>(bench::arg_or(argc, argv, 1, 64));
+  const usize packets = bench::arg_or(argc, argv, 2, 1000000);
+
+  bench_socket(payload, packets);
+  bench_shared_ring(payload, packets);
+#endif
+
+  return 0;
+}
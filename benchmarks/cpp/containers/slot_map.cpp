@@ -0,0 +1,103 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <bench.hpp>
+
+#include <auxid/containers/hash_map.hpp>
+#include <auxid/containers/slot_map.hpp>
+
+using namespace au;
+
+// Usage: BenchSlotMap [entities=1000000] [lookups=10000000]
+//   An entity table keyed by id: HashMap<u64, Entity> versus SlotMap<Entity>. Measures
+//   random lookups, a full iteration pass, and churn (erase + insert of half the table).
+
+struct Entity
+{
+  f32 pos[3];
+  f32 vel[3];
+  u64 id;
+};
+
+auto main(int argc, char *argv[]) -> int
+{
+  auxid::MainThreadGuard _main_thread_guard;
+
+  const usize n = bench::arg_or(argc, argv, 1, 1000000);
+  const usize lookups = bench::arg_or(argc, argv, 2, 10000000);
+
+  Vec<usize> order;
+  order.reserve(lookups);
+  bench::Rng rng;
+  for (usize i = 0; i < lookups; ++i)
+    order.push(rng.next() % n);
+
+  {
+    HashMap<u64, Entity> map;
+    map.reserve(n);
+    for (u64 i = 0; i < n; ++i)
+      map.insert(i, Entity{{0, 0, 0}, {1, 1, 1}, i});
+
+    bench::Timer timer;
+    u64 sum = 0;
+    for (const usize idx : order)
+      sum += map.find(idx)->id;
+    bench::do_not_optimize(sum);
+    bench::report("hash_map/lookup", n, lookups, timer.elapsed_ns());
+
+    timer.reset();
+    for (auto &entry : map)
+      entry.second.pos[0] += entry.second.vel[0];
+    bench::report("hash_map/iterate", n, n, timer.elapsed_ns());
+
+    timer.reset();
+    for (u64 i = 0; i < n; i += 2)
+      map.erase(i);
+    for (u64 i = 0; i < n; i += 2)
+      map.insert(i, Entity{{0, 0, 0}, {1, 1, 1}, i});
+    bench::report("hash_map/churn", n, n, timer.elapsed_ns());
+  }
+
+  {
+    SlotMap<Entity> map;
+    map.reserve(n);
+    Vec<SlotHandle> handles;
+    handles.reserve(n);
+    for (u64 i = 0; i < n; ++i)
+      handles.push(map.insert(Entity{{0, 0, 0}, {1, 1, 1}, i}));
+
+    bench::Timer timer;
+    u64 sum = 0;
+    for (const usize idx : order)
+      sum += map.get(handles[idx])->id;
+    bench::do_not_optimize(sum);
+    bench::report("slot_map/lookup", n, lookups, timer.elapsed_ns());
+
+    timer.reset();
+    for (Entity &e : map)
+      e.pos[0] += e.vel[0];
+    bench::report("slot_map/iterate", n, n, timer.elapsed_ns());
+
+    timer.reset();
+    for (usize i = 0; i < n; i += 2)
+      map.erase(handles[i]);
+    for (usize i = 0; i < n; i += 2)
+      handles[i] = map.insert(Entity{{0, 0, 0}, {1, 1, 1}, i});
+    bench::report("slot_map/churn", n, n, timer.elapsed_ns());
+  }
+
+  return 0;
+}
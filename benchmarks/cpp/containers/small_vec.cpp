@@ -0,0 +1,96 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <bench.hpp>
+
+#include <auxid/containers/small_vec.hpp>
+
+using namespace au;
+
+// Usage: BenchSmallVec [nodes=1000000] [rounds=10]
+//   Builds, walks and tears down `nodes` tree nodes holding 0..4 child indices each,
+//   the shape of AST and routing nodes. Vec pays an allocation per non-leaf node;
+//   SmallVec<u32, 4> pays none.
+
+template<typename ChildrenT> struct Node
+{
+  ChildrenT children;
+  u32 value;
+};
+
+template<typename ChildrenT> auto run(const char *label, const Vec<u8> &fanout, usize rounds) -> void
+{
+  char name[64];
+  const usize n = fanout.size();
+  f64 build_ns = 0;
+  f64 walk_ns = 0;
+  f64 teardown_ns = 0;
+
+  for (usize r = 0; r < rounds; ++r)
+  {
+    bench::Timer timer;
+    auto *nodes = new Vec<Node<ChildrenT>>();
+    nodes->reserve(n);
+    for (usize i = 0; i < n; ++i)
+    {
+      Node<ChildrenT> &node = nodes->emplace_back();
+      node.value = static_cast<u32>(i);
+      for (u8 c = 0; c < fanout[i]; ++c)
+        node.children.push(static_cast<u32>((i * 7 + c) % n));
+    }
+    build_ns += timer.elapsed_ns();
+
+    timer.reset();
+    u64 sum = 0;
+    for (const auto &node : *nodes)
+    {
+      for (const u32 child : node.children)
+        sum += (*nodes)[child].value;
+    }
+    bench::do_not_optimize(sum);
+    walk_ns += timer.elapsed_ns();
+
+    timer.reset();
+    delete nodes;
+    teardown_ns += timer.elapsed_ns();
+  }
+
+  snprintf(name, sizeof(name), "%s/build", label);
+  bench::report(name, n, n * rounds, build_ns);
+  snprintf(name, sizeof(name), "%s/walk", label);
+  bench::report(name, n, n * rounds, walk_ns);
+  snprintf(name, sizeof(name), "%s/teardown", label);
+  bench::report(name, n, n * rounds, teardown_ns);
+}
+
+auto main(int argc, char *argv[]) -> int
+{
+  auxid::MainThreadGuard _main_thread_guard;
+
+  const usize n = bench::arg_or(argc, argv, 1, 1000000);
+  const usize rounds = bench::arg_or(argc, argv, 2, 10);
+
+  Vec<u8> fanout;
+  fanout.reserve(n);
+  bench::Rng rng;
+  for (usize i = 0; i < n; ++i)
+    fanout.push(static_cast<u8>(rng.next() % 5));
+
+  run<Vec<u32>>("vec", fanout, rounds);
+  run<SmallVec<u32, 4>>("small_vec", fanout, rounds);
+
+  return 0;
+}
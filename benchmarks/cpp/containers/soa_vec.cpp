@@ -0,0 +1,94 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <bench.hpp>
+
+#include <auxid/containers/soa_vec.hpp>
+#include <auxid/containers/vec.hpp>
+
+using namespace au;
+
+// Usage: BenchSoaVec [entities=4000000] [steps=20]
+//   Entities have ten 4/8-byte fields; each step integrates position from velocity,
+//   touching two of them. The AoS loop drags whole 56-byte structs through the cache;
+//   the SoA loop streams two columns.
+
+struct Entity
+{
+  f32 pos;
+  f32 vel;
+  f32 mass;
+  f32 radius;
+  u32 flags;
+  u32 owner;
+  u64 id;
+  f64 spawn_time;
+  f64 health;
+  u64 target;
+};
+
+auto main(int argc, char *argv[]) -> int
+{
+  auxid::MainThreadGuard _main_thread_guard;
+
+  const usize n = bench::arg_or(argc, argv, 1, 4000000);
+  const usize steps = bench::arg_or(argc, argv, 2, 20);
+
+  {
+    Vec<Entity> aos;
+    aos.reserve(n);
+    for (usize i = 0; i < n; ++i)
+      aos.push(Entity{0.0f, static_cast<f32>(i & 255), 1.0f, 1.0f, 0, 0, i, 0.0, 100.0, 0});
+
+    bench::Timer timer;
+    for (usize s = 0; s < steps; ++s)
+    {
+      for (Entity &e : aos)
+        e.pos += e.vel * 0.016f;
+    }
+    bench::do_not_optimize(aos[n - 1].pos);
+    bench::report("aos/integrate", n, n * steps, timer.elapsed_ns());
+  }
+
+  {
+    SoaVec<f32, f32, f32, f32, u32, u32, u64, f64, f64, u64> soa;
+    soa.reserve(n);
+    for (usize i = 0; i < n; ++i)
+      soa.push(0.0f, static_cast<f32>(i & 255), 1.0f, 1.0f, 0u, 0u, u64(i), 0.0, 100.0, u64(0));
+
+    bench::Timer timer;
+    for (usize s = 0; s < steps; ++s)
+    {
+      f32 *pos = soa.column<0>().data();
+      const f32 *vel = soa.column<1>().data();
+      for (usize i = 0; i < n; ++i)
+        pos[i] += vel[i] * 0.016f;
+    }
+    bench::do_not_optimize(soa.get<0>(n - 1));
+    bench::report("soa/integrate_columns", n, n * steps, timer.elapsed_ns());
+
+    timer.reset();
+    for (usize s = 0; s < steps; ++s)
+    {
+      for (auto [pos, vel] : soa.zip<0, 1>())
+        pos += vel * 0.016f;
+    }
+    bench::do_not_optimize(soa.get<0>(n - 1));
+    bench::report("soa/integrate_zip", n, n * steps, timer.elapsed_ns());
+  }
+
+  return 0;
+}
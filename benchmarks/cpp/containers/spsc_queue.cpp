@@ -0,0 +1,238 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <bench.hpp>
+
+#include <auxid/containers/spsc_queue.hpp>
+#include <auxid/thread/thread.hpp>
+
+#include <atomic>
+
+#if defined(_WIN32)
+#  include <windows.h>
+#elif defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+
+using namespace au;
+
+// Usage: BenchSpscQueue [producer_core=0] [consumer_core=1] [items=20000000] [round_trips=2000000]
+//   Producer and consumer are pinned to the given cores. "stream" moves `items` u64s
+//   one way through a 1024-slot queue; "pingpong" bounces one value back and forth
+//   over two queues and reports the round-trip time. "uncached" is the previous
+//   SpscQueue, which reloads the other side's index on every call. Only meaningful
+//   when both cores exist and are otherwise idle.
+
+template<typename T, usize Capacity> class UncachedSpscQueue
+{
+  alignas(64) std::atomic<usize> m_write_pos{0};
+  alignas(64) std::atomic<usize> m_read_pos{0};
+  T m_slots[Capacity];
+
+public:
+  bool push(T value)
+  {
+    const usize write_idx = m_write_pos.load(std::memory_order_relaxed);
+    if (write_idx - m_read_pos.load(std::memory_order_acquire) == Capacity)
+      return false;
+    m_slots[write_idx & (Capacity - 1)] = value;
+    m_write_pos.store(write_idx + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T &out_value)
+  {
+    const usize read_idx = m_read_pos.load(std::memory_order_relaxed);
+    if (read_idx == m_write_pos.load(std::memory_order_acquire))
+      return false;
+    out_value = m_slots[read_idx & (Capacity - 1)];
+    m_read_pos.store(read_idx + 1, std::memory_order_release);
+    return true;
+  }
+};
+
+static std::atomic<bool> g_pin_failed{false};
+
+static auto pin_to_core(usize core) -> void
+{
+#if defined(_WIN32)
+  if (core >= 64 || !SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << core))
+    g_pin_failed.store(true);
+#elif defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(core, &set);
+  if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+    g_pin_failed.store(true);
+#else
+  (void) core;
+  g_pin_failed.store(true);
+#endif
+}
+
+// Runs `producer` and `consumer` on their pinned cores and returns the wall time.
+template<typename ProducerFn, typename ConsumerFn>
+auto run_pinned(usize producer_core, usize consumer_core, ProducerFn producer, ConsumerFn consumer) -> f64
+{
+  std::atomic<u32> ready{0};
+  const auto start_pinned = [&ready](usize core) {
+    pin_to_core(core);
+    ready.fetch_add(1);
+    while (ready.load() < 2)
+      thrd_yield();
+  };
+
+  bench::Timer timer;
+  auto producer_thread = std::move(Thread::create([&]() {
+                                     start_pinned(producer_core);
+                                     producer();
+                                   }).unwrap());
+  auto consumer_thread = std::move(Thread::create([&]() {
+                                     start_pinned(consumer_core);
+                                     consumer();
+                                   }).unwrap());
+  producer_thread.join();
+  consumer_thread.join();
+  return timer.elapsed_ns();
+}
+
+template<typename Queue>
+auto stream_single(const char *name, usize producer_core, usize consumer_core, usize items) -> void
+{
+  Queue queue;
+  u64 sum = 0;
+  const f64 ns = run_pinned(
+      producer_core, consumer_core,
+      [&]() {
+        for (u64 i = 0; i < items;)
+        {
+          if (queue.push(i))
+            i++;
+          else
+            thrd_yield();
+        }
+      },
+      [&]() {
+        u64 value;
+        for (u64 i = 0; i < items;)
+        {
+          if (queue.pop(value))
+          {
+            sum += value;
+            i++;
+          }
+          else
+            thrd_yield();
+        }
+      });
+  bench::do_not_optimize(sum);
+  bench::report(name, items, items, ns);
+}
+
+template<usize Batch, typename Queue>
+auto stream_bulk(const char *name, usize producer_core, usize consumer_core, usize items) -> void
+{
+  Queue queue;
+  u64 sum = 0;
+  const f64 ns = run_pinned(
+      producer_core, consumer_core,
+      [&]() {
+        u64 batch[Batch];
+        for (u64 i = 0; i < items;)
+        {
+          const usize count = items - i < Batch ? items - i : Batch;
+          for (usize j = 0; j < count; ++j)
+            batch[j] = i + j;
+          const usize n = queue.push_bulk(Span<u64>(batch, count));
+          i += n;
+          if (n == 0)
+            thrd_yield();
+        }
+      },
+      [&]() {
+        u64 batch[Batch];
+        for (u64 i = 0; i < items;)
+        {
+          const usize n = queue.pop_bulk(Span<u64>(batch, Batch));
+          for (usize j = 0; j < n; ++j)
+            sum += batch[j];
+          i += n;
+          if (n == 0)
+            thrd_yield();
+        }
+      });
+  bench::do_not_optimize(sum);
+  bench::report(name, items, items, ns);
+}
+
+template<typename Queue>
+auto ping_pong(const char *name, usize producer_core, usize consumer_core, usize round_trips) -> void
+{
+  Queue ping;
+  Queue pong;
+  const f64 ns = run_pinned(
+      producer_core, consumer_core,
+      [&]() {
+        u64 value = 0;
+        for (u64 i = 0; i < round_trips; ++i)
+        {
+          while (!ping.push(i))
+            thrd_yield();
+          while (!pong.pop(value))
+            thrd_yield();
+        }
+        bench::do_not_optimize(value);
+      },
+      [&]() {
+        u64 value = 0;
+        for (u64 i = 0; i < round_trips; ++i)
+        {
+          while (!ping.pop(value))
+            thrd_yield();
+          while (!pong.push(value))
+            thrd_yield();
+        }
+      });
+  bench::report(name, round_trips, round_trips, ns);
+}
+
+auto main(int argc, char *argv[]) -> int
+{
+  auxid::MainThreadGuard _main_thread_guard;
+
+  const usize producer_core = bench::arg_or(argc, argv, 1, 0);
+  const usize consumer_core = bench::arg_or(argc, argv, 2, 1);
+  const usize items = bench::arg_or(argc, argv, 3, 20000000);
+  const usize round_trips = bench::arg_or(argc, argv, 4, 2000000);
+  constexpr usize CAPACITY = 1024;
+
+  using Uncached = UncachedSpscQueue<u64, CAPACITY>;
+  using Cached = containers::SpscQueue<u64, CAPACITY>;
+
+  stream_single<Uncached>("stream/uncached", producer_core, consumer_core, items);
+  stream_single<Cached>("stream/cached", producer_core, consumer_core, items);
+  stream_bulk<16, Cached>("stream/cached_bulk16", producer_core, consumer_core, items);
+  stream_bulk<64, Cached>("stream/cached_bulk64", producer_core, consumer_core, items);
+
+  ping_pong<Uncached>("pingpong/uncached", producer_core, consumer_core, round_trips);
+  ping_pong<Cached>("pingpong/cached", producer_core, consumer_core, round_trips);
+
+  if (g_pin_failed.load())
+    printf("note: could not pin to cores %zu/%zu; results are unpinned\n", producer_core, consumer_core);
+
+  return 0;
+}
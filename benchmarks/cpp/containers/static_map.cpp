@@ -0,0 +1,99 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <bench.hpp>
+
+#include <auxid/containers/hash_map.hpp>
+#include <auxid/containers/static_map.hpp>
+
+using namespace au;
+
+// Usage: BenchStaticMap [queries=10000000]
+//   StaticMap vs HashMap with StringView keys at 100, 10k and 1M keys: build time, then
+//   hit and miss lookups.
+
+auto run_size(usize n, usize query_count) -> void
+{
+  bench::Rng rng(n);
+  char name[64];
+
+  Vec<String> storage;
+  storage.reserve(n);
+  for (usize i = 0; i < n; ++i)
+    storage.push(String::format("kw_%llx", static_cast<unsigned long long>(rng.next())));
+
+  Vec<Pair<StringView, u32>> items;
+  items.reserve(n);
+  for (usize i = 0; i < n; ++i)
+    items.push({StringView(storage[i]), static_cast<u32>(i)});
+
+  Vec<String> miss_storage;
+  miss_storage.reserve(n);
+  for (usize i = 0; i < n; ++i)
+    miss_storage.push(String::format("mk_%llx", static_cast<unsigned long long>(rng.next())));
+
+  Vec<u32> queries;
+  queries.reserve(query_count);
+  for (usize i = 0; i < query_count; ++i)
+    queries.push(static_cast<u32>(rng.next() % n));
+
+  bench::Timer timer;
+  auto static_map = StaticMap<StringView, u32>::build(items).unwrap();
+  snprintf(name, sizeof(name), "static_map/build");
+  bench::report(name, n, n, timer.elapsed_ns());
+
+  timer.reset();
+  auto hash_map = HashMap<StringView, u32>::from_unique(items);
+  snprintf(name, sizeof(name), "hash_map/build");
+  bench::report(name, n, n, timer.elapsed_ns());
+
+  u64 sum = 0;
+  timer.reset();
+  for (const u32 q : queries)
+    sum += *static_map.find(items[q].first);
+  bench::report("static_map/find_hit", n, query_count, timer.elapsed_ns());
+
+  timer.reset();
+  for (const u32 q : queries)
+    sum += *hash_map.find(items[q].first);
+  bench::report("hash_map/find_hit", n, query_count, timer.elapsed_ns());
+
+  timer.reset();
+  for (const u32 q : queries)
+    sum += static_map.contains(StringView(miss_storage[q]));
+  bench::report("static_map/find_miss", n, query_count, timer.elapsed_ns());
+
+  timer.reset();
+  for (const u32 q : queries)
+    sum += hash_map.contains(StringView(miss_storage[q]));
+  bench::report("hash_map/find_miss", n, query_count, timer.elapsed_ns());
+
+  bench::do_not_optimize(sum);
+  putchar('\n');
+}
+
+auto main(int argc, char *argv[]) -> int
+{
+  auxid::MainThreadGuard _main_thread_guard;
+
+  const usize query_count = bench::arg_or(argc, argv, 1, 10000000);
+
+  run_size(100, query_count);
+  run_size(10000, query_count);
+  run_size(1000000, query_count);
+
+  return 0;
+}
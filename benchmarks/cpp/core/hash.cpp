@@ -0,0 +1,82 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <bench.hpp>
+
+#include <auxid/hash.hpp>
+#include <auxid/containers/vec.hpp>
+
+using namespace au;
+
+// Usage: BenchHash [iterations_scale=1]
+
+// The byte-at-a-time FNV-1a that hash_string_view used previously.
+static auto fnv1a(const void *data, usize len) -> u64
+{
+  const u8 *p = static_cast<const u8 *>(data);
+  u64 hash = 14695981039346656037ULL;
+  for (usize i = 0; i < len; ++i)
+  {
+    hash ^= p[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+template<typename HashFn>
+auto run_size(const char *label, const Vec<u8> &payload, usize len, usize iterations, HashFn hash_fn) -> void
+{
+  char name[64];
+  snprintf(name, sizeof(name), "%s/%zu", label, len);
+
+  // Slide the window so short keys do not stay in a single cache line.
+  const usize span = payload.size() - len;
+  u64 acc = 0;
+
+  bench::Timer timer;
+  for (usize i = 0; i < iterations; ++i)
+    acc += hash_fn(payload.data() + ((i * 64) % (span + 1)), len);
+  bench::do_not_optimize(acc);
+
+  bench::report_bytes(name, len, iterations, timer.elapsed_ns());
+}
+
+auto main(int argc, char *argv[]) -> int
+{
+  auxid::MainThreadGuard _main_thread_guard;
+
+  const u64 scale = bench::arg_or(argc, argv, 1, 1);
+
+  Vec<u8> payload;
+  payload.resize(1 << 21);
+  bench::Rng rng;
+  for (usize i = 0; i < payload.size(); ++i)
+    payload[i] = static_cast<u8>(rng.next());
+
+  const usize sizes[] = {8, 12, 16, 24, 32, 64, 256, 4096, 1 << 20};
+  const u64 seed = hash_seed();
+
+  for (const usize len : sizes)
+  {
+    const usize iterations = static_cast<usize>(scale) * (len >= 4096 ? (256u << 20) / len : 10000000u);
+
+    run_size("fnv1a", payload, len, iterations, [](const void *p, usize n) { return fnv1a(p, n); });
+    run_size("hash_bytes", payload, len, iterations,
+             [seed](const void *p, usize n) { return hash_bytes(p, n, seed); });
+  }
+
+  return 0;
+}
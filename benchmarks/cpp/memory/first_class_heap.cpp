@@ -0,0 +1,86 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <bench.hpp>
+
+#include <auxid/containers/vec.hpp>
+#include <auxid/memory/first_class_heap.hpp>
+
+using namespace au;
+
+// Usage: BenchFirstClassHeap [objects=200000] [sessions=20]
+//   Each session allocates `objects` blocks of 16..512 bytes, then tears everything down.
+//   heap/teardown frees every block individually; first_class/teardown is one free_all().
+
+auto main(int argc, char *argv[]) -> int
+{
+  auxid::MainThreadGuard _main_thread_guard;
+
+  const usize n = bench::arg_or(argc, argv, 1, 200000);
+  const usize sessions = bench::arg_or(argc, argv, 2, 20);
+
+  Vec<usize> sizes;
+  sizes.reserve(n);
+  bench::Rng rng;
+  for (usize i = 0; i < n; ++i)
+    sizes.push(16 + rng.next() % 497);
+
+  Vec<void *> ptrs;
+  ptrs.resize(n, nullptr);
+
+  {
+    memory::HeapAllocator allocator;
+    f64 alloc_ns = 0;
+    f64 teardown_ns = 0;
+    for (usize s = 0; s < sessions; ++s)
+    {
+      bench::Timer timer;
+      for (usize i = 0; i < n; ++i)
+        ptrs[i] = allocator.alloc(sizes[i], 16);
+      alloc_ns += timer.elapsed_ns();
+
+      timer.reset();
+      for (usize i = 0; i < n; ++i)
+        allocator.free(ptrs[i], sizes[i], 16);
+      teardown_ns += timer.elapsed_ns();
+    }
+    bench::report("heap/alloc", n, n * sessions, alloc_ns);
+    bench::report("heap/teardown", n, n * sessions, teardown_ns);
+  }
+
+  {
+    memory::FirstClassHeap heap;
+    memory::FirstClassHeapAllocator allocator = heap.allocator();
+    f64 alloc_ns = 0;
+    f64 teardown_ns = 0;
+    for (usize s = 0; s < sessions; ++s)
+    {
+      bench::Timer timer;
+      for (usize i = 0; i < n; ++i)
+        ptrs[i] = allocator.alloc(sizes[i], 16);
+      alloc_ns += timer.elapsed_ns();
+      bench::do_not_optimize(ptrs[n - 1]);
+
+      timer.reset();
+      heap.free_all();
+      teardown_ns += timer.elapsed_ns();
+    }
+    bench::report("first_class/alloc", n, n * sessions, alloc_ns);
+    bench::report("first_class/teardown", n, n * sessions, teardown_ns);
+  }
+
+  return 0;
+}
@@ -0,0 +1,100 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <bench.hpp>
+
+#include <auxid/containers/hash_map.hpp>
+#include <auxid/memory/large_page.hpp>
+
+using namespace au;
+
+// Usage: BenchLargePage [entries=36000000] [queries=20000000] [numa_node=-1]
+//   Random-access HashMap<u64, u64>::find on a table of ~1.2GB (entries + buckets + control
+//   bytes), once on the regular heap and once on huge pages. At this size nearly every
+//   probe misses both the caches and the TLB, so the difference is the page walks saved.
+
+template<typename MapT> auto run(const char *label, MapT map, const Vec<u64> &keys, const Vec<u64> &queries) -> void
+{
+  char name[64];
+  const usize n = keys.size();
+
+  bench::Timer timer;
+  map.reserve(n);
+  for (usize i = 0; i < n; ++i)
+    map.insert(keys[i], i);
+  snprintf(name, sizeof(name), "%s/insert", label);
+  bench::report(name, n, n, timer.elapsed_ns());
+
+  u64 sum = 0;
+  timer.reset();
+  for (usize i = 0; i < queries.size(); ++i)
+    sum += *map.find(keys[queries[i]]);
+  bench::do_not_optimize(sum);
+  snprintf(name, sizeof(name), "%s/find_hit", label);
+  bench::report(name, n, queries.size(), timer.elapsed_ns());
+
+  usize misses = 0;
+  timer.reset();
+  for (usize i = 0; i < queries.size(); ++i)
+    misses += map.find(~keys[queries[i]]) == nullptr;
+  bench::do_not_optimize(misses);
+  snprintf(name, sizeof(name), "%s/find_miss", label);
+  bench::report(name, n, queries.size(), timer.elapsed_ns());
+}
+
+auto main(int argc, char *argv[]) -> int
+{
+  auxid::MainThreadGuard _main_thread_guard;
+
+  const usize n = bench::arg_or(argc, argv, 1, 36000000);
+  const usize query_count = bench::arg_or(argc, argv, 2, 20000000);
+
+  memory::LargePageOptions options;
+  options.numa_node = argc > 3 ? atoi(argv[3]) : -1;
+
+  usize buckets = 16;
+  while (buckets < n * 2)
+    buckets *= 2;
+  const usize table_mb = (n * sizeof(Pair<u64, u64>) + buckets * (sizeof(u32) + 1)) >> 20;
+
+  memory::LargePageKind kind = memory::LargePageKind::None;
+  memory::unmap_large_pages(memory::map_large_pages(memory::LARGE_PAGE_SIZE, options, &kind),
+                            memory::LARGE_PAGE_SIZE);
+  const char *kind_name = kind == memory::LargePageKind::Explicit      ? "explicit"
+                          : kind == memory::LargePageKind::Transparent ? "transparent"
+                                                                       : "none (small-page fallback)";
+  printf("table ~%zu MB, huge pages: %s, numa node: %d\n", table_mb, kind_name, options.numa_node);
+
+  bench::Rng rng;
+  Vec<u64> keys;
+  keys.reserve(n);
+  for (usize i = 0; i < n; ++i)
+    keys.push(rng.next());
+
+  Vec<u64> queries;
+  queries.reserve(query_count);
+  for (usize i = 0; i < query_count; ++i)
+    queries.push(rng.next() % n);
+
+  // One table at a time, so both never have to fit in memory together.
+  run("heap", HashMap<u64, u64>(), keys, queries);
+
+  using LargeMap = containers::HashMap<u64, u64, containers::Hash<u64>, containers::EqualTo<u64>,
+                                       memory::LargePageAllocator>;
+  run("large_page", LargeMap(memory::LargePageAllocator(options)), keys, queries);
+
+  return 0;
+}
@@ -0,0 +1,119 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <bench.hpp>
+
+#include <auxid/containers/vec.hpp>
+#include <auxid/memory/pool.hpp>
+#include <auxid/thread/thread.hpp>
+
+using namespace au;
+
+// Usage: BenchPool [live_objects=100000] [rounds=50]
+//   alloc_free: one allocation freed right away (steady-state churn).
+//   batch:      `live_objects` allocations, then all of them freed, repeated `rounds` times.
+//   handoff:    a producer allocates a batch, a consumer thread frees it (cross-thread frees).
+//   Each workload runs on the heap (rpmalloc) and on the pool, for 64-byte nodes.
+
+struct Node
+{
+  u64 payload[8];
+};
+
+template<typename AllocatorT> auto run_alloc_free(const char *label, usize ops) -> void
+{
+  AllocatorT allocator;
+  bench::Timer timer;
+  for (usize i = 0; i < ops; ++i)
+  {
+    void *p = allocator.alloc(sizeof(Node), alignof(Node));
+    bench::do_not_optimize(p);
+    allocator.free(p, sizeof(Node), alignof(Node));
+  }
+  const f64 elapsed = timer.elapsed_ns();
+
+  char name[64];
+  snprintf(name, sizeof(name), "%s/alloc_free", label);
+  bench::report(name, 1, ops, elapsed);
+}
+
+template<typename AllocatorT> auto run_batch(const char *label, usize n, usize rounds) -> void
+{
+  AllocatorT allocator;
+  Vec<void *> ptrs;
+  ptrs.resize(n, nullptr);
+
+  bench::Timer timer;
+  for (usize r = 0; r < rounds; ++r)
+  {
+    for (usize i = 0; i < n; ++i)
+      ptrs[i] = allocator.alloc(sizeof(Node), alignof(Node));
+    for (usize i = 0; i < n; ++i)
+      allocator.free(ptrs[i], sizeof(Node), alignof(Node));
+  }
+  const f64 elapsed = timer.elapsed_ns();
+
+  char name[64];
+  snprintf(name, sizeof(name), "%s/batch", label);
+  bench::report(name, n, n * rounds * 2, elapsed);
+}
+
+template<typename AllocatorT> auto run_handoff(const char *label, usize n, usize rounds) -> void
+{
+  AllocatorT allocator;
+  Vec<void *> ptrs;
+  ptrs.resize(n, nullptr);
+
+  bench::Timer timer;
+  for (usize r = 0; r < rounds; ++r)
+  {
+    for (usize i = 0; i < n; ++i)
+      ptrs[i] = allocator.alloc(sizeof(Node), alignof(Node));
+
+    auto consumer = Thread::create([&]() {
+                      AllocatorT local;
+                      for (usize i = 0; i < n; ++i)
+                        local.free(ptrs[i], sizeof(Node), alignof(Node));
+                    }).unwrap();
+    consumer.join();
+  }
+  const f64 elapsed = timer.elapsed_ns();
+
+  char name[64];
+  snprintf(name, sizeof(name), "%s/handoff", label);
+  bench::report(name, n, n * rounds * 2, elapsed);
+}
+
+auto main(int argc, char *argv[]) -> int
+{
+  auxid::MainThreadGuard _main_thread_guard;
+
+  const usize n = bench::arg_or(argc, argv, 1, 100000);
+  const usize rounds = bench::arg_or(argc, argv, 2, 50);
+
+  using Pool = memory::PoolAllocator<Node>;
+
+  run_alloc_free<memory::HeapAllocator>("heap", n * rounds);
+  run_alloc_free<Pool>("pool", n * rounds);
+
+  run_batch<memory::HeapAllocator>("heap", n, rounds);
+  run_batch<Pool>("pool", n, rounds);
+
+  run_handoff<memory::HeapAllocator>("heap", n, rounds);
+  run_handoff<Pool>("pool", n, rounds);
+
+  return 0;
+}
@@ -0,0 +1,92 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <auxid/auxid.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace au::bench
+{
+  class Timer
+  {
+    std::chrono::steady_clock::time_point m_start = std::chrono::steady_clock::now();
+
+public:
+    auto reset() -> void
+    {
+      m_start = std::chrono::steady_clock::now();
+    }
+
+    [[nodiscard]] auto elapsed_ns() const -> f64
+    {
+      return std::chrono::duration<f64, std::nano>(std::chrono::steady_clock::now() - m_start).count();
+    }
+  };
+
+  // Keeps `value` observable so the optimizer cannot drop the work producing it.
+  template<typename T> inline auto do_not_optimize(const T &value) -> void
+  {
+#if defined(_MSC_VER) && !defined(__clang__)
+    static const volatile void *s_sink;
+    s_sink = &value;
+    _ReadWriteBarrier();
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+  }
+
+  // SplitMix64
+  struct Rng
+  {
+    u64 state;
+
+    explicit Rng(u64 seed = 0x9E3779B97F4A7C15ULL) : state(seed)
+    {
+    }
+
+    auto next() -> u64
+    {
+      u64 z = (state += 0x9E3779B97F4A7C15ULL);
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+      return z ^ (z >> 31);
+    }
+  };
+
+  inline auto arg_or(int argc, char *argv[], int index, u64 fallback) -> u64
+  {
+    if (index < argc)
+      return strtoull(argv[index], nullptr, 10);
+    return fallback;
+  }
+
+  inline auto report(const char *name, usize n, usize ops, f64 elapsed_ns) -> void
+  {
+    const f64 ns_per_op = ops ? elapsed_ns / static_cast<f64>(ops) : 0.0;
+    printf("%-36s n=%-11zu %10.2f ns/op %10.2f Mops/s\n", name, n, ns_per_op, ns_per_op > 0 ? 1e3 / ns_per_op : 0.0);
+  }
+
+  inline auto report_bytes(const char *name, usize bytes_per_op, usize ops, f64 elapsed_ns) -> void
+  {
+    const f64 ns_per_op = ops ? elapsed_ns / static_cast<f64>(ops) : 0.0;
+    const f64 gb_per_s = elapsed_ns > 0 ? (static_cast<f64>(bytes_per_op) * static_cast<f64>(ops)) / elapsed_ns : 0.0;
+    printf("%-36s bytes=%-9zu %10.2f ns/op %10.2f GB/s\n", name, bytes_per_op, ns_per_op, gb_per_s);
+  }
+} // namespace au::bench
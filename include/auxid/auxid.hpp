@@ -16,6 +16,7 @@
 #pragma once
 
 #include <auxid/result.hpp>
+#include <auxid/memory/arena.hpp>
 #include <auxid/thread/mutex.hpp>
 #include <auxid/std_wrappers/function.hpp>
 #include <auxid/std_wrappers/filesystem.hpp>
@@ -127,8 +128,13 @@ public:
     }
 
 private:
+    // Messages up to this many chars are formatted on the stack; longer ones allocate.
+    static constexpr usize INLINE_MESSAGE_CAPACITY = 511;
+
     static auto default_handler(const char *msg, ELevel level) -> void;
 
+    auto vlog(ELevel level, const char *fmt, va_list args) -> void;
+
     Mutex &m_logger_mutex_ref;
     LogHandler_FuncT m_handler{default_handler};
   };
@@ -139,6 +145,26 @@ private:
   namespace auxid
 
   {
+    // ========================================================
+    // Runtime Configuration
+    //
+    // Read by each thread as it is initialized, so set it before
+    // `initialize_main_thread` and before spawning workers.
+    // ========================================================
+
+    struct RuntimeConfig
+    {
+      // Initial block size of each per-thread scratch arena.
+      usize scratch_arena_size = usize(64) << 10;
+      // Back every heap span with huge pages (rpmalloc's enable_huge_pages), falling back
+      // to transparent huge pages and then small pages. Read once, by the main thread.
+      // For huge pages on a few large buffers only, see memory::LargePageAllocator.
+      bool heap_huge_pages = false;
+    };
+
+    auto set_runtime_config(const RuntimeConfig &config) -> void;
+    auto get_runtime_config() -> const RuntimeConfig &;
+
     // ========================================================
     // Thread Lifetime Management
     //
@@ -187,5 +213,65 @@ private:
     auto is_thread_initialized() -> bool;
 
     auto get_thread_logger() -> Logger &;
+
+    // ========================================================
+    // Scratch Arenas
+    //
+    // Every initialized thread owns two scratch arenas for
+    // short-lived allocations. A function that builds its result
+    // in one scratch arena can take its temporaries from the
+    // other by passing the first as `conflict`.
+    //
+    // Scratch memory must not outlive the `ScratchScope` it was
+    // allocated under, nor leave the thread that allocated it.
+    // ========================================================
+
+    using ScratchArena = memory::ChainedArenaAllocator<>;
+
+    // Returns one of the calling thread's scratch arenas, never `conflict`.
+    auto get_thread_scratch(const ScratchArena *conflict = nullptr) -> ScratchArena &;
+
+    // Rewinds a scratch arena to where it was when the scope was opened.
+    struct ScratchScope : memory::ArenaScope<ScratchArena>
+    {
+      explicit ScratchScope(const ScratchArena *conflict = nullptr)
+          : memory::ArenaScope<ScratchArena>(get_thread_scratch(conflict))
+      {
+      }
+    };
+
+    // Stateless allocator over the calling thread's primary scratch arena (the one a
+    // default `ScratchScope` rewinds), so containers can take it as a template argument
+    // alone: `VecT<T, usize, auxid::ScratchAllocator>`, `HashMap<K, V, Hasher, KeyEq,
+    // auxid::ScratchAllocator>`.
+    struct ScratchAllocator
+    {
+      inline void *alloc(usize size)
+      {
+        return get_thread_scratch().alloc(size);
+      }
+
+      inline void *alloc(usize size, usize align)
+      {
+        return get_thread_scratch().alloc(size, align);
+      }
+
+      inline void *realloc(void *ptr, usize old_size, usize new_size, usize align)
+      {
+        return get_thread_scratch().realloc(ptr, old_size, new_size, align);
+      }
+
+      inline bool try_expand_in_place(void *ptr, usize old_size, usize new_size, usize align)
+      {
+        return get_thread_scratch().try_expand_in_place(ptr, old_size, new_size, align);
+      }
+
+      inline void free(void *ptr, usize size, usize align)
+      {
+        get_thread_scratch().free(ptr, size, align);
+      }
+    };
+
+    static_assert(memory::AllocatorType<ScratchAllocator>, "Allocator class must conform to AllocatorT");
   } // namespace auxid
 } // namespace au
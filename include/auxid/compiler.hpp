@@ -24,6 +24,14 @@
 #  include <intrin.h>
 #endif
 
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  define AUXID_SIMD_SSE2 1
+#  include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#  define AUXID_SIMD_NEON 1
+#  include <arm_neon.h>
+#endif
+
 #if defined(__clang__) || defined(__GNUC__)
 #  define AUXID_ATTR_CONST __attribute__((const))
 #  define AUXID_ATTR_PURE __attribute__((pure))
@@ -73,5 +81,29 @@ namespace au
     {
       return std::memchr(p, c, n);
     }
+
+    // Read prefetch into all cache levels. A hint only; never faults on a bad address.
+    inline void prefetch(const void *p) noexcept
+    {
+#if defined(__clang__) || defined(__GNUC__)
+      __builtin_prefetch(p, 0, 3);
+#elif defined(AUXID_SIMD_SSE2)
+      _mm_prefetch(static_cast<const char *>(p), _MM_HINT_T0);
+#else
+      (void) p;
+#endif
+    }
+
+    // Spin-wait hint; lets the sibling hyperthread run and saves power in busy loops.
+    inline void cpu_relax() noexcept
+    {
+#if defined(AUXID_SIMD_SSE2)
+      _mm_pause();
+#elif defined(__aarch64__) && (defined(__clang__) || defined(__GNUC__))
+      __asm__ __volatile__("yield");
+#elif defined(_M_ARM64)
+      __yield();
+#endif
+    }
   } // namespace compiler
 } // namespace au
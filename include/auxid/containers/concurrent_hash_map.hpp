@@ -0,0 +1,281 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <auxid/containers/hash_map.hpp>
+#include <auxid/containers/option.hpp>
+#include <auxid/thread/mutex.hpp>
+#include <auxid/thread/rw_lock.hpp>
+
+namespace au::containers
+{
+  /*
+  NOTE: The table is split into a power-of-two number of HashMap shards, each behind its
+        own RwSpinLock, and the shard is picked from the key's hash. Lookups only take a
+        shared lock so reads on different (or the same) shards proceed in parallel.
+
+        No reference into the table escapes a lock: get() copies the value out, and
+        visit()/modify() run a callback while the shard is locked. Keep callbacks short
+        and never touch the same map from inside one.
+  */
+  template<typename K, typename V, typename Hasher = Hash<K>, typename KeyEq = EqualTo<K>,
+           typename AllocatorT = memory::HeapAllocator, typename HashCacheT = NoHashCache>
+    requires memory::AllocatorType<AllocatorT>
+  class ConcurrentHashMap
+  {
+public:
+    using map_type = HashMap<K, V, Hasher, KeyEq, AllocatorT, HashCacheT>;
+    using size_type = usize;
+
+    static constexpr usize DEFAULT_SHARD_COUNT = 64;
+
+private:
+    using hash_type = typename map_type::hash_type;
+
+    struct alignas(64) Shard
+    {
+      mutable RwSpinLock lock;
+      map_type map;
+
+      explicit Shard(const AllocatorT &allocator) : map(allocator)
+      {
+      }
+    };
+
+    Shard *m_shards = nullptr;
+    usize m_shard_shift = 0;
+    usize m_shard_count = 0;
+
+    Hasher m_hasher;
+    AUXID_NO_UNIQUE_ADDRESS AllocatorT m_allocator;
+
+public:
+    explicit ConcurrentHashMap(usize shard_count = DEFAULT_SHARD_COUNT) : ConcurrentHashMap(AllocatorT(), shard_count)
+    {
+    }
+
+    // For stateful allocators (arenas, first-class heaps); the shard array and every
+    // shard's map use it.
+    explicit ConcurrentHashMap(AllocatorT allocator, usize shard_count = DEFAULT_SHARD_COUNT)
+        : m_allocator(std::move(allocator))
+    {
+      m_shard_count = 1;
+      while (m_shard_count < shard_count)
+        m_shard_count *= 2;
+      usize bits = 0;
+      while ((usize(1) << bits) < m_shard_count)
+        bits++;
+      m_shard_shift = 64 - bits;
+
+      m_shards = static_cast<Shard *>(m_allocator.alloc(sizeof(Shard) * m_shard_count, alignof(Shard)));
+      if (!m_shards)
+        panic("ConcurrentHashMap: shard allocation failed");
+      for (usize i = 0; i < m_shard_count; ++i)
+        au::construct_at(&m_shards[i], m_allocator);
+    }
+
+    ~ConcurrentHashMap()
+    {
+      for (usize i = 0; i < m_shard_count; ++i)
+        au::destroy_at(&m_shards[i]);
+      m_allocator.free(m_shards, sizeof(Shard) * m_shard_count, alignof(Shard));
+    }
+
+    ConcurrentHashMap(const ConcurrentHashMap &) = delete;
+    ConcurrentHashMap &operator=(const ConcurrentHashMap &) = delete;
+
+public:
+    // Pre-sizes every shard for an even share of `total_cap` entries.
+    void reserve(size_type total_cap)
+    {
+      const size_type per_shard = (total_cap + m_shard_count - 1) / m_shard_count;
+      for (usize i = 0; i < m_shard_count; ++i)
+      {
+        LockGuard<RwSpinLock> lock(m_shards[i].lock);
+        m_shards[i].map.reserve(per_shard + per_shard / 8);
+      }
+    }
+
+    void clear()
+    {
+      for (usize i = 0; i < m_shard_count; ++i)
+      {
+        LockGuard<RwSpinLock> lock(m_shards[i].lock);
+        m_shards[i].map.clear();
+      }
+    }
+
+    bool insert(const K &key, const V &val)
+    {
+      const hash_type h = hash_key(key);
+      Shard &shard = shard_for(h);
+      LockGuard<RwSpinLock> lock(shard.lock);
+
+      if (shard.map.find_slot(key, h) != map_type::SLOT_INVALID)
+        return false;
+      shard.map.prepare_insert(h);
+      shard.map.m_entries.push(typename map_type::value_type{key, val});
+      return true;
+    }
+
+    bool insert(const K &key, V &&val)
+    {
+      const hash_type h = hash_key(key);
+      Shard &shard = shard_for(h);
+      LockGuard<RwSpinLock> lock(shard.lock);
+
+      if (shard.map.find_slot(key, h) != map_type::SLOT_INVALID)
+        return false;
+      shard.map.prepare_insert(h);
+      shard.map.m_entries.push(typename map_type::value_type{key, std::move(val)});
+      return true;
+    }
+
+    // Returns true if the key was newly inserted, false if an existing value was overwritten.
+    bool insert_or_assign(const K &key, V val)
+    {
+      const hash_type h = hash_key(key);
+      Shard &shard = shard_for(h);
+      LockGuard<RwSpinLock> lock(shard.lock);
+
+      const usize slot = shard.map.find_slot(key, h);
+      if (slot != map_type::SLOT_INVALID)
+      {
+        shard.map.m_entries[shard.map.m_buckets[slot]].second = std::move(val);
+        return false;
+      }
+      shard.map.prepare_insert(h);
+      shard.map.m_entries.push(typename map_type::value_type{key, std::move(val)});
+      return true;
+    }
+
+    [[nodiscard]] Option<V> get(const K &key) const
+    {
+      const hash_type h = hash_key(key);
+      const Shard &shard = shard_for(h);
+      SharedLockGuard<RwSpinLock> lock(shard.lock);
+
+      const usize slot = shard.map.find_slot(key, h);
+      if (slot == map_type::SLOT_INVALID)
+        return nullopt;
+      return Option<V>(shard.map.m_entries[shard.map.m_buckets[slot]].second);
+    }
+
+    [[nodiscard]] bool contains(const K &key) const
+    {
+      const hash_type h = hash_key(key);
+      const Shard &shard = shard_for(h);
+      SharedLockGuard<RwSpinLock> lock(shard.lock);
+
+      return shard.map.find_slot(key, h) != map_type::SLOT_INVALID;
+    }
+
+    // Calls `f(const V &)` under the shard's shared lock. Returns false if the key is absent.
+    template<typename F> bool visit(const K &key, F &&f) const
+    {
+      const hash_type h = hash_key(key);
+      const Shard &shard = shard_for(h);
+      SharedLockGuard<RwSpinLock> lock(shard.lock);
+
+      const usize slot = shard.map.find_slot(key, h);
+      if (slot == map_type::SLOT_INVALID)
+        return false;
+      f(static_cast<const V &>(shard.map.m_entries[shard.map.m_buckets[slot]].second));
+      return true;
+    }
+
+    // Calls `f(V &)` under the shard's exclusive lock. Returns false if the key is absent.
+    template<typename F> bool modify(const K &key, F &&f)
+    {
+      const hash_type h = hash_key(key);
+      Shard &shard = shard_for(h);
+      LockGuard<RwSpinLock> lock(shard.lock);
+
+      const usize slot = shard.map.find_slot(key, h);
+      if (slot == map_type::SLOT_INVALID)
+        return false;
+      f(shard.map.m_entries[shard.map.m_buckets[slot]].second);
+      return true;
+    }
+
+    bool erase(const K &key)
+    {
+      const hash_type h = hash_key(key);
+      Shard &shard = shard_for(h);
+      LockGuard<RwSpinLock> lock(shard.lock);
+
+      const usize slot = shard.map.find_slot(key, h);
+      if (slot == map_type::SLOT_INVALID)
+        return false;
+      shard.map.remove_at_bucket(slot);
+      return true;
+    }
+
+    // Calls `f(const K &, const V &)` for every entry, one shard at a time. Not a snapshot:
+    // writes to shards that were already visited (or not yet reached) may or may not be seen.
+    template<typename F> void for_each(F &&f) const
+    {
+      for (usize i = 0; i < m_shard_count; ++i)
+      {
+        SharedLockGuard<RwSpinLock> lock(m_shards[i].lock);
+        for (const auto &entry : m_shards[i].map)
+          f(entry.first, entry.second);
+      }
+    }
+
+    // Sum of all shard sizes; only exact while no other thread is writing.
+    [[nodiscard]] size_type size() const
+    {
+      size_type total = 0;
+      for (usize i = 0; i < m_shard_count; ++i)
+      {
+        SharedLockGuard<RwSpinLock> lock(m_shards[i].lock);
+        total += m_shards[i].map.size();
+      }
+      return total;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+      return size() == 0;
+    }
+
+    [[nodiscard]] usize shard_count() const
+    {
+      return m_shard_count;
+    }
+
+private:
+    hash_type hash_key(const K &key) const
+    {
+      return static_cast<hash_type>(m_hasher(key));
+    }
+
+    // The shard comes from a Fibonacci re-mix of the hash so it stays independent of the
+    // low bits the shard's own control bytes and bucket index are taken from.
+    Shard &shard_for(hash_type h) const
+    {
+      const u64 mixed = static_cast<u64>(h) * 11400714819323198485ULL;
+      return m_shards[m_shard_count == 1 ? 0 : (mixed >> m_shard_shift)];
+    }
+  };
+} // namespace au::containers
+
+namespace au
+{
+  template<typename K, typename V> using ConcurrentHashMap = containers::ConcurrentHashMap<K, V>;
+}
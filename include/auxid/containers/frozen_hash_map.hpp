@@ -0,0 +1,415 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <auxid/containers/hash_base.hpp>
+#include <auxid/containers/vec.hpp>
+#include <auxid/memory/mapped_file.hpp>
+#include <auxid/result.hpp>
+
+namespace au::containers
+{
+  namespace frozen
+  {
+    inline constexpr u64 MAGIC = 0x314E5A5246585541ULL; // "AUXFRZN1", little-endian
+    inline constexpr u32 VERSION = 1;
+    inline constexpr usize SECTION_ALIGN = 64;
+
+    enum class KeyKind : u32
+    {
+      Trivial = 0,
+      String = 1,
+    };
+
+    // Every offset is relative to the start of the image, so the image can be mapped at
+    // any address. All sections start on a SECTION_ALIGN boundary.
+    struct Header
+    {
+      u64 magic;
+      u32 version;
+      KeyKind key_kind;
+      u32 key_size;
+      u32 value_size;
+      u32 entry_size;
+      u32 entry_align;
+      u64 seed;
+      u64 entry_count;
+      u64 bucket_count;
+      u64 ctrl_offset;
+      u64 buckets_offset;
+      u64 entries_offset;
+      u64 strings_offset;
+      u64 strings_size;
+      u64 total_size;
+    };
+
+    // String keys are stored as a slice of the image's string pool.
+    struct StringRef
+    {
+      u64 offset;
+      u64 length;
+    };
+
+    // Types whose bytes are process-local addresses, which mean nothing once the image is
+    // loaded elsewhere. Pointer members inside user structs cannot be detected; do not
+    // freeze those either.
+    template<typename T> struct HoldsAddress
+        : std::bool_constant<std::is_pointer_v<T> || std::is_member_pointer_v<T> || std::is_null_pointer_v<T>>
+    {
+    };
+
+    template<typename T, usize N> struct HoldsAddress<T[N]> : HoldsAddress<T>
+    {
+    };
+
+    template<> struct HoldsAddress<StringView> : std::true_type
+    {
+    };
+
+    template<typename T> struct HoldsAddress<Span<T>> : std::true_type
+    {
+    };
+
+    // Trivially copyable keys without padding hash and compare by their bytes.
+    template<typename K> struct KeyTraits
+    {
+      static_assert(std::has_unique_object_representations_v<K>,
+                    "FrozenHashMap keys must be String or trivially copyable without padding bytes");
+      static_assert(!HoldsAddress<std::remove_cv_t<K>>::value,
+                    "FrozenHashMap keys must not hold addresses (pointers, StringView, Span); use String");
+
+      using stored_type = K;
+      using lookup_type = K;
+      static constexpr KeyKind KIND = KeyKind::Trivial;
+
+      static u64 hash(const K &key, u64 seed)
+      {
+        return hash_bytes(&key, sizeof(K), seed);
+      }
+
+      static bool equal(const K &stored, const K &key, const u8 *, u64)
+      {
+        return compiler::memcmp(&stored, &key, sizeof(K)) == 0;
+      }
+    };
+
+    template<> struct KeyTraits<String>
+    {
+      using stored_type = StringRef;
+      using lookup_type = StringView;
+      static constexpr KeyKind KIND = KeyKind::String;
+
+      static u64 hash(StringView key, u64 seed)
+      {
+        return hash_bytes(key.data(), key.size(), seed);
+      }
+
+      static bool equal(const StringRef &stored, StringView key, const u8 *strings, u64 strings_size)
+      {
+        if (stored.length != key.size() || stored.offset > strings_size || stored.length > strings_size - stored.offset)
+          return false;
+        return compiler::memcmp(strings + stored.offset, key.data(), key.size()) == 0;
+      }
+    };
+
+    inline auto align_up(u64 v, u64 align) -> u64
+    {
+      return (v + align - 1) & ~(align - 1);
+    }
+  } // namespace frozen
+
+  /*
+  NOTE: Read-only hash table that lives in a flat, relocatable byte image (control bytes,
+        bucket indices, entries, and a string pool for String keys). serialize()/write()
+        produce the image from a HashMap; open()/from_memory() answer lookups directly out
+        of it with no deserialization step.
+
+        The image stores the seed it was hashed with, so it stays valid across processes.
+        It is in native byte order and layout, so share it only between builds for the
+        same target. The header and section bounds are validated when the image is
+        opened; the sections themselves are trusted.
+  */
+  template<typename K, typename V> class FrozenHashMap
+  {
+    static_assert(std::is_trivially_copyable_v<V>, "FrozenHashMap values must be trivially copyable");
+    static_assert(!frozen::HoldsAddress<std::remove_cv_t<V>>::value,
+                  "FrozenHashMap values must not hold addresses (pointers, StringView, Span)");
+
+    using Traits = frozen::KeyTraits<K>;
+    using stored_key = typename Traits::stored_type;
+
+public:
+    using lookup_type = typename Traits::lookup_type;
+    using size_type = usize;
+
+    struct Entry
+    {
+      stored_key key;
+      V value;
+    };
+
+private:
+    memory::MappedFile m_file;
+
+    const u8 *m_image = nullptr;
+    const u8 *m_ctrl = nullptr;
+    const u32 *m_buckets = nullptr;
+    const Entry *m_entries = nullptr;
+    const u8 *m_strings = nullptr;
+    u64 m_strings_size = 0;
+    u64 m_seed = 0;
+    usize m_count = 0;
+    usize m_mask = 0;
+
+public:
+    FrozenHashMap() = default;
+
+    FrozenHashMap(FrozenHashMap &&) noexcept = default;
+    FrozenHashMap &operator=(FrozenHashMap &&) noexcept = default;
+
+    FrozenHashMap(const FrozenHashMap &) = delete;
+    FrozenHashMap &operator=(const FrozenHashMap &) = delete;
+
+public:
+    // Builds the image for `map`. Works with any HashMap<K, V, ...> (or anything iterating
+    // Pair<K, V>), whatever its hasher, since the image is rehashed with its own seed.
+    template<typename MapT> [[nodiscard]] static auto serialize(const MapT &map) -> Vec<u8>
+    {
+      usize count = 0;
+      u64 strings_size = 0;
+      for (const auto &entry : map)
+      {
+        count++;
+        if constexpr (Traits::KIND == frozen::KeyKind::String)
+          strings_size += entry.first.size();
+      }
+
+      u64 bucket_count = ctrl::GROUP_WIDTH;
+      while (bucket_count < count * 2)
+        bucket_count *= 2;
+
+      frozen::Header header{};
+      header.magic = frozen::MAGIC;
+      header.version = frozen::VERSION;
+      header.key_kind = Traits::KIND;
+      header.key_size = sizeof(stored_key);
+      header.value_size = sizeof(V);
+      header.entry_size = sizeof(Entry);
+      header.entry_align = alignof(Entry);
+      header.seed = hash_seed();
+      header.entry_count = count;
+      header.bucket_count = bucket_count;
+      header.ctrl_offset = frozen::align_up(sizeof(frozen::Header), frozen::SECTION_ALIGN);
+      header.buckets_offset =
+          frozen::align_up(header.ctrl_offset + bucket_count + ctrl::GROUP_WIDTH, frozen::SECTION_ALIGN);
+      header.entries_offset = frozen::align_up(header.buckets_offset + bucket_count * sizeof(u32), frozen::SECTION_ALIGN);
+      header.strings_offset = frozen::align_up(header.entries_offset + count * sizeof(Entry), frozen::SECTION_ALIGN);
+      header.strings_size = strings_size;
+      header.total_size = header.strings_offset + strings_size;
+
+      // Zero-filled so padding inside entries never carries stale memory into the file.
+      Vec<u8> image;
+      image.resize(static_cast<usize>(header.total_size), 0);
+      u8 *base = image.data();
+      std::memcpy(base, &header, sizeof(header));
+
+      u8 *ctrl_bytes = base + header.ctrl_offset;
+      std::memset(ctrl_bytes, ctrl::EMPTY, bucket_count + ctrl::GROUP_WIDTH);
+      u32 *buckets = reinterpret_cast<u32 *>(base + header.buckets_offset);
+      Entry *entries = reinterpret_cast<Entry *>(base + header.entries_offset);
+      u8 *strings = base + header.strings_offset;
+
+      const usize mask = static_cast<usize>(bucket_count - 1);
+      u64 string_cursor = 0;
+      u32 idx = 0;
+
+      for (const auto &entry : map)
+      {
+        Entry &out = entries[idx];
+        u64 h;
+        if constexpr (Traits::KIND == frozen::KeyKind::String)
+        {
+          const StringView key = entry.first;
+          std::memcpy(strings + string_cursor, key.data(), key.size());
+          out.key = frozen::StringRef{string_cursor, key.size()};
+          string_cursor += key.size();
+          h = Traits::hash(key, header.seed);
+        }
+        else
+        {
+          out.key = entry.first;
+          h = Traits::hash(entry.first, header.seed);
+        }
+        out.value = entry.second;
+
+        ProbeSeq seq(h, mask);
+        while (true)
+        {
+          const auto match = CtrlGroup(ctrl_bytes + seq.offset()).match_empty_or_deleted();
+          if (match)
+          {
+            const usize slot = seq.offset(match.lowest());
+            ctrl_bytes[slot] = ctrl::h2(h);
+            if (slot < ctrl::GROUP_WIDTH)
+              ctrl_bytes[slot + bucket_count] = ctrl::h2(h);
+            buckets[slot] = idx;
+            break;
+          }
+          seq.next();
+        }
+        idx++;
+      }
+
+      return image;
+    }
+
+    template<typename MapT> static auto write(const char *path, const MapT &map) -> Result<void>
+    {
+      const Vec<u8> image = serialize(map);
+      return memory::write_file(path, image.as_span());
+    }
+
+    static auto open(const char *path) -> Result<FrozenHashMap>
+    {
+      AU_TRY_VAR(file, memory::MappedFile::open(path));
+      AU_TRY_VAR(map, from_memory(file.as_span()));
+      map.m_file = std::move(file);
+      return map;
+    }
+
+    // Views an image held elsewhere (e.g. embedded in the binary or read into a buffer).
+    // The bytes must stay alive and unmodified for the lifetime of the returned map.
+    static auto from_memory(Span<const u8> image) -> Result<FrozenHashMap>
+    {
+      if (image.size() < sizeof(frozen::Header))
+        return fail("frozen hash map: image too small");
+      if (reinterpret_cast<uintptr_t>(image.data()) % alignof(Entry) != 0 ||
+          reinterpret_cast<uintptr_t>(image.data()) % alignof(frozen::Header) != 0)
+        return fail("frozen hash map: image is not suitably aligned");
+
+      frozen::Header header;
+      std::memcpy(&header, image.data(), sizeof(header));
+
+      if (header.magic != frozen::MAGIC)
+        return fail("frozen hash map: bad magic");
+      if (header.version != frozen::VERSION)
+        return fail("frozen hash map: unsupported version %u", header.version);
+      if (header.key_kind != Traits::KIND || header.key_size != sizeof(stored_key) || header.value_size != sizeof(V) ||
+          header.entry_size != sizeof(Entry) || header.entry_align != alignof(Entry))
+        return fail("frozen hash map: image was written for a different key/value layout");
+
+      const u64 buckets = header.bucket_count;
+      if (buckets < ctrl::GROUP_WIDTH || (buckets & (buckets - 1)) != 0 || header.entry_count > buckets ||
+          header.entry_count > static_cast<u64>(INDEX_INVALID))
+        return fail("frozen hash map: corrupt bucket count");
+
+      const auto section_ok = [&](u64 offset, u64 size) {
+        return offset % frozen::SECTION_ALIGN == 0 && offset <= header.total_size && size <= header.total_size - offset;
+      };
+      if (header.total_size > image.size() || !section_ok(header.ctrl_offset, buckets + ctrl::GROUP_WIDTH) ||
+          !section_ok(header.buckets_offset, buckets * sizeof(u32)) ||
+          !section_ok(header.entries_offset, header.entry_count * sizeof(Entry)) ||
+          !section_ok(header.strings_offset, header.strings_size))
+        return fail("frozen hash map: section out of bounds");
+
+      FrozenHashMap map;
+      map.m_image = image.data();
+      map.m_ctrl = image.data() + header.ctrl_offset;
+      map.m_buckets = reinterpret_cast<const u32 *>(image.data() + header.buckets_offset);
+      map.m_entries = reinterpret_cast<const Entry *>(image.data() + header.entries_offset);
+      map.m_strings = image.data() + header.strings_offset;
+      map.m_strings_size = header.strings_size;
+      map.m_seed = header.seed;
+      map.m_count = static_cast<usize>(header.entry_count);
+      map.m_mask = static_cast<usize>(buckets - 1);
+      return map;
+    }
+
+public:
+    [[nodiscard]] const V *find(const lookup_type &key) const
+    {
+      if (!m_image)
+        return nullptr;
+
+      const u64 h = Traits::hash(key, m_seed);
+      ProbeSeq seq(h, m_mask);
+      const u8 h2 = ctrl::h2(h);
+
+      while (true)
+      {
+        const CtrlGroup group(m_ctrl + seq.offset());
+
+        for (auto match = group.match(h2); match; match.clear_lowest())
+        {
+          const u32 entry_idx = m_buckets[seq.offset(match.lowest())];
+          if (entry_idx >= m_count)
+            continue;
+
+          const Entry &entry = m_entries[entry_idx];
+          if (Traits::equal(entry.key, key, m_strings, m_strings_size))
+            return &entry.value;
+        }
+
+        if (group.match_empty())
+          return nullptr;
+
+        seq.next();
+
+        if (seq.index() > m_mask)
+          return nullptr;
+      }
+    }
+
+    [[nodiscard]] bool contains(const lookup_type &key) const
+    {
+      return find(key) != nullptr;
+    }
+
+    [[nodiscard]] size_type size() const
+    {
+      return m_count;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+      return m_count == 0;
+    }
+
+    // Key of entry `idx` in [0, size()), for iterating the image in storage order.
+    [[nodiscard]] lookup_type key_at(usize idx) const
+    {
+      if constexpr (Traits::KIND == frozen::KeyKind::String)
+      {
+        const frozen::StringRef &ref = m_entries[idx].key;
+        return StringView(reinterpret_cast<const char *>(m_strings + ref.offset), static_cast<usize>(ref.length));
+      }
+      else
+      {
+        return m_entries[idx].key;
+      }
+    }
+
+    [[nodiscard]] const V &value_at(usize idx) const
+    {
+      return m_entries[idx].value;
+    }
+  };
+} // namespace au::containers
+
+namespace au
+{
+  template<typename K, typename V> using FrozenHashMap = containers::FrozenHashMap<K, V>;
+}
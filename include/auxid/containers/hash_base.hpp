@@ -18,22 +18,251 @@
 #include <auxid/containers/pair.hpp>
 #include <auxid/containers/string.hpp>
 
+#include <bit>
+#include <concepts>
+
 namespace au::containers
 {
   static constexpr u32 INDEX_INVALID = UINT32_MAX;
 
+  // =============================================================================
+  // Control Bytes
+  //
+  // Each bucket of a HashMap/HashSet has one control byte: EMPTY, DELETED, or the
+  // low 7 bits of the key hash (H2) when the bucket is full. Lookups load a whole
+  // group of control bytes and match H2 against all of them in one compare, so most
+  // hits touch a single entry and most misses touch none.
+  // =============================================================================
+  namespace ctrl
+  {
+    static constexpr u8 EMPTY = 0x80;
+    static constexpr u8 DELETED = 0xFE;
+
+    static constexpr usize GROUP_WIDTH = 16;
+
+    [[nodiscard]] constexpr bool is_full(u8 c)
+    {
+      return (c & 0x80) == 0;
+    }
+
+    [[nodiscard]] constexpr usize h1(u64 hash)
+    {
+      return static_cast<usize>(hash >> 7);
+    }
+
+    [[nodiscard]] constexpr u8 h2(u64 hash)
+    {
+      return static_cast<u8>(hash & 0x7F);
+    }
+  } // namespace ctrl
+
+  // Set of slot indices within a group, as produced by CtrlGroup::match*().
+  // Each slot owns (1 << SHIFT) bits of the mask.
+  template<u32 SHIFT> class CtrlBitMask
+  {
+    u64 m_bits;
+
+public:
+    constexpr explicit CtrlBitMask(u64 bits) : m_bits(bits)
+    {
+    }
+
+    constexpr explicit operator bool() const
+    {
+      return m_bits != 0;
+    }
+
+    [[nodiscard]] constexpr u32 lowest() const
+    {
+      return trailing_zeros();
+    }
+
+    [[nodiscard]] constexpr u32 trailing_zeros() const
+    {
+      return static_cast<u32>(std::countr_zero(m_bits)) >> SHIFT;
+    }
+
+    [[nodiscard]] constexpr u32 leading_zeros() const
+    {
+      constexpr u32 UNUSED_BITS = 64 - static_cast<u32>(ctrl::GROUP_WIDTH << SHIFT);
+      return (static_cast<u32>(std::countl_zero(m_bits)) - UNUSED_BITS) >> SHIFT;
+    }
+
+    constexpr void clear_lowest()
+    {
+      m_bits &= m_bits - 1;
+    }
+  };
+
+  class CtrlGroup
+  {
+public:
+#if defined(AUXID_SIMD_NEON)
+    using BitMask = CtrlBitMask<2>;
+#else
+    using BitMask = CtrlBitMask<0>;
+#endif
+
+    // `ctrl` must have at least GROUP_WIDTH readable bytes (no alignment required).
+    explicit CtrlGroup(const u8 *ctrl)
+    {
+#if defined(AUXID_SIMD_SSE2)
+      m_ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl));
+#elif defined(AUXID_SIMD_NEON)
+      m_ctrl = vld1q_u8(ctrl);
+#else
+      std::memcpy(m_ctrl, ctrl, ctrl::GROUP_WIDTH);
+#endif
+    }
+
+    [[nodiscard]] BitMask match(u8 h2) const
+    {
+#if defined(AUXID_SIMD_SSE2)
+      return to_mask(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(h2)), m_ctrl));
+#elif defined(AUXID_SIMD_NEON)
+      return to_mask(vceqq_u8(vdupq_n_u8(h2), m_ctrl));
+#else
+      return match_if([h2](u8 c) { return c == h2; });
+#endif
+    }
+
+    [[nodiscard]] BitMask match_empty() const
+    {
+#if defined(AUXID_SIMD_SSE2)
+      return to_mask(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(ctrl::EMPTY)), m_ctrl));
+#elif defined(AUXID_SIMD_NEON)
+      return to_mask(vceqq_u8(vdupq_n_u8(ctrl::EMPTY), m_ctrl));
+#else
+      return match_if([](u8 c) { return c == ctrl::EMPTY; });
+#endif
+    }
+
+    // EMPTY and DELETED are the only negative control bytes when read as i8.
+    [[nodiscard]] BitMask match_empty_or_deleted() const
+    {
+#if defined(AUXID_SIMD_SSE2)
+      return to_mask(_mm_cmpgt_epi8(_mm_set1_epi8(-1), m_ctrl));
+#elif defined(AUXID_SIMD_NEON)
+      return to_mask(vcltq_s8(vreinterpretq_s8_u8(m_ctrl), vdupq_n_s8(-1)));
+#else
+      return match_if([](u8 c) { return !ctrl::is_full(c); });
+#endif
+    }
+
+private:
+#if defined(AUXID_SIMD_SSE2)
+    __m128i m_ctrl;
+
+    static BitMask to_mask(__m128i cmp)
+    {
+      return BitMask(static_cast<u32>(_mm_movemask_epi8(cmp)));
+    }
+#elif defined(AUXID_SIMD_NEON)
+    uint8x16_t m_ctrl;
+
+    // Narrows each 0x00/0xFF lane to a nibble, giving a 64-bit mask with 4 bits per slot.
+    static BitMask to_mask(uint8x16_t cmp)
+    {
+      const uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(cmp), 4);
+      return BitMask(vget_lane_u64(vreinterpret_u64_u8(narrowed), 0));
+    }
+#else
+    u8 m_ctrl[ctrl::GROUP_WIDTH];
+
+    template<typename Pred> BitMask match_if(Pred pred) const
+    {
+      u64 bits = 0;
+      for (usize i = 0; i < ctrl::GROUP_WIDTH; ++i)
+        bits |= static_cast<u64>(pred(m_ctrl[i])) << i;
+      return BitMask(bits);
+    }
+#endif
+  };
+
+  // Triangular probing over groups. Visits every group exactly once when the
+  // bucket count is a power of two and a multiple of GROUP_WIDTH.
+  class ProbeSeq
+  {
+    usize m_mask;
+    usize m_offset;
+    usize m_index = 0;
+
+public:
+    ProbeSeq(u64 hash, usize mask) : m_mask(mask), m_offset(ctrl::h1(hash) & mask)
+    {
+    }
+
+    [[nodiscard]] usize offset() const
+    {
+      return m_offset;
+    }
+
+    [[nodiscard]] usize offset(u32 i) const
+    {
+      return (m_offset + i) & m_mask;
+    }
+
+    [[nodiscard]] usize index() const
+    {
+      return m_index;
+    }
+
+    void next()
+    {
+      m_index += ctrl::GROUP_WIDTH;
+      m_offset = (m_offset + m_index) & m_mask;
+    }
+  };
+
+  // =============================================================================
+  // Hash Caching Policies
+  //
+  // Chooses whether a HashMap/HashSet keeps every entry's hash in a dense array
+  // parallel to its entries. Caching costs 4 or 8 bytes per entry, but growth,
+  // erase and swap-with-end fix-ups never touch key bytes again, and lookups
+  // compare the full hash before calling KeyEq. Worth it for keys that are
+  // expensive to hash or compare, such as String.
+  //
+  // HashCache32 truncates every hash (including lookups) to 32 bits, which keeps
+  // bucket placement well distributed up to 2^25 buckets.
+  // =============================================================================
+  struct NoHashCache
+  {
+    using hash_type = u64;
+    static constexpr bool ENABLED = false;
+  };
+
+  struct HashCache32
+  {
+    using hash_type = u32;
+    static constexpr bool ENABLED = true;
+  };
+
+  struct HashCache64
+  {
+    using hash_type = u64;
+    static constexpr bool ENABLED = true;
+  };
+
+  template<typename T>
+  concept HashCachePolicy = requires {
+    typename T::hash_type;
+    { T::ENABLED } -> std::convertible_to<bool>;
+  };
+
+  // Hasher and KeyEq both opt in with `using is_transparent = void;` to let a container be
+  // probed with a key type other than K (e.g. a StringView into a String-keyed map).
+  template<typename Hasher, typename KeyEq>
+  concept TransparentLookup = requires {
+    typename Hasher::is_transparent;
+    typename KeyEq::is_transparent;
+  };
+
   template<typename T> struct Hash
   {
     u64 operator()(const T &val) const noexcept
     {
-      const u8 *ptr = reinterpret_cast<const u8 *>(&val);
-      u64 hash = 14695981039346656037ULL;
-      for (usize i = 0; i < sizeof(T); ++i)
-      {
-        hash ^= ptr[i];
-        hash *= 1099511628211ULL;
-      }
-      return hash;
+      return hash_bytes(&val, sizeof(T), hash_seed());
     }
   };
 
@@ -67,9 +296,11 @@ namespace au::containers
     }
   };
 
-  template<> struct Hash<String>
+  template<typename A> struct Hash<StringT<A>>
   {
-    u64 operator()(const String &s) const
+    using is_transparent = void;
+
+    u64 operator()(StringView s) const
     {
       return hash_string_view(s);
     }
@@ -77,6 +308,8 @@ namespace au::containers
 
   template<> struct Hash<StringView>
   {
+    using is_transparent = void;
+
     u64 operator()(StringView s) const
     {
       return hash_string_view(s);
@@ -98,4 +331,24 @@ namespace au::containers
       return lhs == rhs;
     }
   };
+
+  template<typename A> struct EqualTo<StringT<A>>
+  {
+    using is_transparent = void;
+
+    bool operator()(StringView lhs, StringView rhs) const
+    {
+      return lhs == rhs;
+    }
+  };
+
+  template<> struct EqualTo<StringView>
+  {
+    using is_transparent = void;
+
+    constexpr bool operator()(StringView lhs, StringView rhs) const
+    {
+      return lhs == rhs;
+    }
+  };
 } // namespace au::containers
\ No newline at end of file
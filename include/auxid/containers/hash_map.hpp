@@ -27,8 +27,8 @@ namespace au::containers
         iterators and pointers like vector::erase, NOT like std::unordered_map::erase.
   */
   template<typename K, typename V, typename Hasher = Hash<K>, typename KeyEq = EqualTo<K>,
-           typename AllocatorT = memory::HeapAllocator>
-    requires memory::AllocatorType<AllocatorT>
+           typename AllocatorT = memory::HeapAllocator, typename HashCacheT = NoHashCache>
+    requires memory::AllocatorType<AllocatorT> && HashCachePolicy<HashCacheT>
   class HashMap
   {
 public:
@@ -45,15 +45,35 @@ public:
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
 private:
+    static constexpr usize SLOT_INVALID = static_cast<usize>(-1);
+
+    using hash_type = typename HashCacheT::hash_type;
+
+    struct NoCachedHashes
+    {
+    };
+
     VecT<value_type, usize, AllocatorT> m_entries;
+    // Parallel to m_entries when HashCacheT::ENABLED.
+    AUXID_NO_UNIQUE_ADDRESS std::conditional_t<HashCacheT::ENABLED, VecT<hash_type, usize, AllocatorT>, NoCachedHashes>
+        m_hashes;
     VecT<u32, usize, AllocatorT> m_buckets;
+    // One control byte per bucket, followed by a copy of the first GROUP_WIDTH
+    // bytes so a group can be loaded at any bucket without wrapping.
+    VecT<u8, usize, AllocatorT> m_ctrl;
 
     size_type m_mask = 0;
-    size_type m_max_probe_dist = 0;
+    size_type m_tombstones = 0;
 
     Hasher m_hasher;
     KeyEq m_eq;
 
+    // Shards hash the key once to pick a shard and reuse that hash for the probe.
+    // The template-head must match ConcurrentHashMap's own declaration, constraint included.
+    template<typename, typename, typename, typename, typename AllocT, typename>
+      requires memory::AllocatorType<AllocT>
+    friend class ConcurrentHashMap;
+
 public:
     explicit HashMap()
     {
@@ -64,14 +84,59 @@ public:
       reserve(cap);
     }
 
+    // For stateful allocators (arenas, first-class heaps); every internal array uses it.
+    explicit HashMap(AllocatorT allocator) : m_entries(allocator), m_buckets(allocator), m_ctrl(allocator)
+    {
+      if constexpr (HashCacheT::ENABLED)
+        m_hashes = VecT<hash_type, usize, AllocatorT>(allocator);
+    }
+
+    [[nodiscard]] const AllocatorT &get_allocator() const
+    {
+      return m_entries.get_allocator();
+    }
+
+    // Builds a map from `items`, keeping the first occurrence of each key.
+    [[nodiscard]] static HashMap build(Span<const value_type> items, AllocatorT allocator = AllocatorT())
+    {
+      HashMap map(std::move(allocator));
+      map.insert_many(items);
+      return map;
+    }
+
+    // Builds a map from `items` whose keys the caller guarantees are distinct. Skips the
+    // per-element lookup entirely; duplicates are caught in debug builds only.
+    [[nodiscard]] static HashMap from_unique(Span<const value_type> items, AllocatorT allocator = AllocatorT())
+    {
+      HashMap map(std::move(allocator));
+      map.m_entries.reserve(items.size());
+      if constexpr (HashCacheT::ENABLED)
+        map.m_hashes.reserve(items.size());
+
+      for (const auto &item : items)
+        map.m_entries.push(item);
+#if !defined(NDEBUG)
+      map.bulk_index(0, [&map](usize idx, hash_type h) {
+        if (map.find_slot(map.m_entries[idx].first, h) != SLOT_INVALID)
+          panic("HashMap::from_unique called with duplicate keys");
+        return true;
+      });
+#else
+      map.bulk_index(0, [](usize, hash_type) { return true; });
+#endif
+      return map;
+    }
+
 public:
     void reserve(size_type new_cap)
     {
       if (new_cap <= m_entries.capacity())
         return;
       m_entries.reserve(new_cap);
+      if constexpr (HashCacheT::ENABLED)
+        m_hashes.reserve(new_cap);
 
-      size_type buckets_cap = 8;
+      size_type buckets_cap = ctrl::GROUP_WIDTH;
       while (buckets_cap < new_cap * 2)
         buckets_cap *= 2;
       rehash_buckets(buckets_cap);
@@ -80,97 +145,73 @@ public:
     void clear()
     {
       m_entries.clear();
-      if (!m_buckets.empty())
+      if constexpr (HashCacheT::ENABLED)
+        m_hashes.clear();
+      if (!m_ctrl.empty())
       {
-        std::fill(m_buckets.begin(), m_buckets.end(), INDEX_INVALID);
+        std::fill(m_ctrl.begin(), m_ctrl.end(), ctrl::EMPTY);
       }
+      m_tombstones = 0;
     }
 
     V &operator[](const K &key)
     {
-      if (should_grow())
-        grow();
+      const auto h = hash_key(key);
 
-      auto h = hash_key(key);
-      auto idx = h & m_mask;
+      const usize slot = find_slot(key, h);
+      if (slot != SLOT_INVALID)
+        return m_entries[m_buckets[slot]].second;
 
-      while (true)
-      {
-        u32 entry_idx = m_buckets[idx];
-
-        if (entry_idx == INDEX_INVALID)
-        {
-          m_buckets[idx] = static_cast<u32>(m_entries.size());
-          m_entries.push(value_type{key, V{}});
-          return m_entries.data()[m_entries.size() - 1].second;
-        }
-
-        if (m_eq(m_entries[entry_idx].first, key))
-        {
-          return m_entries[entry_idx].second;
-        }
-
-        idx = (idx + 1) & m_mask;
-      }
+      prepare_insert(h);
+      m_entries.push(value_type{key, V{}});
+      return m_entries.data()[m_entries.size() - 1].second;
     }
 
     bool insert(const K &key, const V &val)
     {
-      if (contains(key))
+      const auto h = hash_key(key);
+      if (find_slot(key, h) != SLOT_INVALID)
         return false;
 
-      if (should_grow())
-        grow();
-
-      u32 entry_idx = static_cast<u32>(m_entries.size());
+      prepare_insert(h);
       m_entries.push(value_type{key, val});
-
-      insert_into_buckets(entry_idx, key);
       return true;
     }
 
     bool insert(const K &key, V &&val)
     {
-      if (contains(key))
+      const auto h = hash_key(key);
+      if (find_slot(key, h) != SLOT_INVALID)
         return false;
 
-      if (should_grow())
-        grow();
-
-      u32 entry_idx = static_cast<u32>(m_entries.size());
+      prepare_insert(h);
       m_entries.push(value_type{key, std::move(val)});
-
-      insert_into_buckets(entry_idx, key);
       return true;
     }
 
-    V *find(const K &key)
+    // Inserts every pair whose key is not already present (first occurrence wins) and
+    // returns how many were added. Buckets are sized once up front, hashes are computed
+    // in batches, and each element's probe start is prefetched a few elements ahead.
+    size_type insert_many(Span<const value_type> items)
     {
-      if (m_buckets.empty())
-        return nullptr;
-
-      auto h = hash_key(key);
-      auto idx = h & m_mask;
-      auto dist = 0;
-
-      while (true)
-      {
-        u32 entry_idx = m_buckets[idx];
+      const usize first = m_entries.size();
+      m_entries.reserve(first + items.size());
+      if constexpr (HashCacheT::ENABLED)
+        m_hashes.reserve(first + items.size());
 
-        if (entry_idx == INDEX_INVALID)
-          return nullptr;
+      for (const auto &item : items)
+        m_entries.push(item);
 
-        if (m_eq(m_entries[entry_idx].first, key))
-        {
-          return &m_entries[entry_idx].second;
-        }
-
-        dist++;
-        idx = (idx + 1) & m_mask;
+      return bulk_index(first,
+                        [this](usize idx, hash_type h) { return find_slot(m_entries[idx].first, h) == SLOT_INVALID; });
+    }
 
-        if (dist > (i32) m_mask)
-          return nullptr;
-      }
+    V *find(const K &key)
+    {
+      const usize slot = find_slot(key, hash_key(key));
+      if (slot == SLOT_INVALID)
+        return nullptr;
+      return &m_entries[m_buckets[slot]].second;
     }
 
     bool contains(const K &key)
@@ -180,27 +221,59 @@ public:
 
     bool erase(const K &key)
     {
-      if (m_buckets.empty())
+      const usize slot = find_slot(key, hash_key(key));
+      if (slot == SLOT_INVALID)
         return false;
 
-      auto h = hash_key(key);
-      auto idx = h & m_mask;
+      remove_at_bucket(slot);
+      return true;
+    }
 
-      while (true)
-      {
-        u32 entry_idx = m_buckets[idx];
+    // Heterogeneous lookup. With a transparent Hasher/KeyEq (the default for String keys)
+    // these take any compatible key, e.g. a StringView or const char*, so probing never
+    // builds a temporary K. operator[] constructs K from the key only when inserting.
+    template<typename Q>
+      requires TransparentLookup<Hasher, KeyEq> && std::constructible_from<K, const Q &>
+    V &operator[](const Q &key)
+    {
+      const auto h = hash_key(key);
 
-        if (entry_idx == INDEX_INVALID)
-          return false;
+      const usize slot = find_slot(key, h);
+      if (slot != SLOT_INVALID)
+        return m_entries[m_buckets[slot]].second;
 
-        if (m_eq(m_entries[entry_idx].first, key))
-        {
-          remove_at_bucket(idx, entry_idx);
-          return true;
-        }
+      prepare_insert(h);
+      m_entries.push(value_type{K(key), V{}});
+      return m_entries.data()[m_entries.size() - 1].second;
+    }
 
-        idx = (idx + 1) & m_mask;
-      }
+    template<typename Q>
+      requires TransparentLookup<Hasher, KeyEq>
+    V *find(const Q &key)
+    {
+      const usize slot = find_slot(key, hash_key(key));
+      if (slot == SLOT_INVALID)
+        return nullptr;
+      return &m_entries[m_buckets[slot]].second;
+    }
+
+    template<typename Q>
+      requires TransparentLookup<Hasher, KeyEq>
+    bool contains(const Q &key)
+    {
+      return find(key) != nullptr;
+    }
+
+    template<typename Q>
+      requires TransparentLookup<Hasher, KeyEq>
+    bool erase(const Q &key)
+    {
+      const usize slot = find_slot(key, hash_key(key));
+      if (slot == SLOT_INVALID)
+        return false;
+
+      remove_at_bucket(slot);
+      return true;
     }
 
     value_type *begin()
@@ -274,108 +347,276 @@ public:
     }
 
 private:
-    u64 hash_key(const K &key) const
+    template<typename Q> hash_type hash_key(const Q &key) const
+    {
+      return static_cast<hash_type>(m_hasher(key));
+    }
+
+    hash_type entry_hash(u32 entry_idx) const
     {
-      return m_hasher(key);
+      if constexpr (HashCacheT::ENABLED)
+        return m_hashes[entry_idx];
+      else
+        return hash_key(m_entries[entry_idx].first);
+    }
+
+    static constexpr usize BULK_BATCH = 64;
+    static constexpr usize BULK_PREFETCH_DISTANCE = 8;
+
+    void prefetch_probe(u64 h) const
+    {
+      const usize offset = ctrl::h1(h) & m_mask;
+      compiler::prefetch(m_ctrl.data() + offset);
+      compiler::prefetch(m_buckets.data() + offset);
+    }
+
+    // Indexes entries [first, size()) that were pushed to m_entries without buckets.
+    // `keep(idx, h)` is asked about each entry right before it is indexed; rejected
+    // entries are dropped and the tail is compacted in place. Returns the number kept.
+    template<typename KeepFn> usize bulk_index(usize first, KeepFn &&keep)
+    {
+      const usize end = m_entries.size();
+
+      // Size the buckets for the whole batch now, while only [0, first) is indexed, so
+      // the loop below never has to grow.
+      if (m_buckets.empty() || (end + m_tombstones) * 10 >= m_buckets.size() * 8)
+      {
+        size_type buckets_cap = m_buckets.empty() ? ctrl::GROUP_WIDTH : m_buckets.size();
+        while (buckets_cap < end * 2)
+          buckets_cap *= 2;
+
+        rehash_buckets(buckets_cap, first);
+      }
+
+      hash_type hashes[BULK_BATCH];
+      usize write = first;
+
+      for (usize base = first; base < end; base += BULK_BATCH)
+      {
+        const usize count = (end - base) < BULK_BATCH ? (end - base) : BULK_BATCH;
+
+        for (usize i = 0; i < count; ++i)
+          hashes[i] = hash_key(m_entries[base + i].first);
+
+        for (usize i = 0; i < count && i < BULK_PREFETCH_DISTANCE; ++i)
+          prefetch_probe(hashes[i]);
+
+        for (usize i = 0; i < count; ++i)
+        {
+          if (i + BULK_PREFETCH_DISTANCE < count)
+            prefetch_probe(hashes[i + BULK_PREFETCH_DISTANCE]);
+
+          const usize idx = base + i;
+          const hash_type h = hashes[i];
+
+          // Everything before `write` is already indexed, so keep() also sees duplicates
+          // from earlier in the same batch.
+          if (!keep(idx, h))
+            continue;
+
+          if (write != idx)
+            m_entries[write] = std::move(m_entries[idx]);
+
+          insert_into_buckets(static_cast<u32>(write), h);
+          if constexpr (HashCacheT::ENABLED)
+            m_hashes.push(h);
+          write++;
+        }
+      }
+
+      while (m_entries.size() > write)
+        m_entries.pop();
+      return write - first;
     }
 
     [[nodiscard]] bool should_grow() const
     {
-      return m_entries.size() * 10 >= m_buckets.size() * 8 || m_buckets.empty();
+      return (m_entries.size() + m_tombstones) * 10 >= m_buckets.size() * 8 || m_buckets.empty();
     }
 
     void grow()
     {
-      size_type new_cap = (m_buckets.empty()) ? 16 : m_buckets.size() * 2;
-      rehash_buckets(new_cap);
+      if (m_buckets.empty())
+        rehash_buckets(ctrl::GROUP_WIDTH);
+      // Mostly tombstones: rebuild at the same size to reclaim them.
+      else if (m_entries.size() * 10 < m_buckets.size() * 4)
+        rehash_buckets(m_buckets.size());
+      else
+        rehash_buckets(m_buckets.size() * 2);
     }
 
     void rehash_buckets(size_type new_cap)
     {
+      rehash_buckets(new_cap, m_entries.size());
+    }
+
+    // Rebuilds the buckets for the first `indexed_count` entries only.
+    void rehash_buckets(size_type new_cap, usize indexed_count)
+    {
+      m_ctrl.clear();
+      m_ctrl.reserve(new_cap + ctrl::GROUP_WIDTH);
+      m_ctrl.resize(new_cap + ctrl::GROUP_WIDTH, ctrl::EMPTY);
+
       m_buckets.clear();
       m_buckets.reserve(new_cap);
 
       m_buckets.resize(new_cap, INDEX_INVALID);
 
       m_mask = new_cap - 1;
+      m_tombstones = 0;
+
+      for (u32 i = 0; i < indexed_count; ++i)
+      {
+        insert_into_buckets(i, entry_hash(i));
+      }
+    }
+
+    void set_ctrl(usize slot, u8 c)
+    {
+      m_ctrl[slot] = c;
+      if (slot < ctrl::GROUP_WIDTH)
+        m_ctrl[slot + m_buckets.size()] = c;
+    }
+
+    template<typename Q> [[nodiscard]] usize find_slot(const Q &key, u64 h) const
+    {
+      if (m_buckets.empty())
+        return SLOT_INVALID;
+
+      ProbeSeq seq(h, m_mask);
+      const u8 h2 = ctrl::h2(h);
 
-      for (u32 i = 0; i < m_entries.size(); ++i)
+      while (true)
       {
-        insert_into_buckets(i, m_entries[i].first);
+        const CtrlGroup group(m_ctrl.data() + seq.offset());
+
+        for (auto match = group.match(h2); match; match.clear_lowest())
+        {
+          const usize slot = seq.offset(match.lowest());
+          const u32 entry_idx = m_buckets[slot];
+
+          if constexpr (HashCacheT::ENABLED)
+          {
+            if (m_hashes[entry_idx] != h)
+              continue;
+          }
+
+          if (m_eq(m_entries[entry_idx].first, key))
+            return slot;
+        }
+
+        if (group.match_empty())
+          return SLOT_INVALID;
+
+        seq.next();
+
+        if (seq.index() > m_mask)
+          return SLOT_INVALID;
       }
     }
 
-    void insert_into_buckets(u32 entry_idx, const K &key)
+    [[nodiscard]] usize find_free_slot(u64 h) const
     {
-      auto h = hash_key(key);
-      auto idx = h & m_mask;
+      ProbeSeq seq(h, m_mask);
 
-      while (m_buckets[idx] != INDEX_INVALID)
+      while (true)
       {
-        idx = (idx + 1) & m_mask;
+        const auto match = CtrlGroup(m_ctrl.data() + seq.offset()).match_empty_or_deleted();
+        if (match)
+          return seq.offset(match.lowest());
+
+        seq.next();
       }
+    }
+
+    // Claims a bucket for the entry about to be pushed to the back of m_entries.
+    void prepare_insert(u64 h)
+    {
+      if (should_grow())
+        grow();
 
-      m_buckets[idx] = entry_idx;
+      insert_into_buckets(static_cast<u32>(m_entries.size()), h);
+
+      if constexpr (HashCacheT::ENABLED)
+        m_hashes.push(static_cast<hash_type>(h));
     }
 
-    void remove_at_bucket(u32 bucket_idx, u32 entry_idx_to_remove)
+    void insert_into_buckets(u32 entry_idx, u64 h)
     {
-      backward_shift(bucket_idx);
+      const usize slot = find_free_slot(h);
+
+      if (m_ctrl[slot] == ctrl::DELETED)
+        m_tombstones--;
+
+      set_ctrl(slot, ctrl::h2(h));
+      m_buckets[slot] = entry_idx;
+    }
+
+    void remove_at_bucket(usize bucket_idx)
+    {
+      const u32 entry_idx_to_remove = m_buckets[bucket_idx];
+
+      erase_ctrl(bucket_idx);
 
       u32 last_idx = static_cast<u32>(m_entries.size() - 1);
 
       if (entry_idx_to_remove != last_idx)
       {
         m_entries[entry_idx_to_remove] = std::move(m_entries[last_idx]);
+        if constexpr (HashCacheT::ENABLED)
+          m_hashes[entry_idx_to_remove] = m_hashes[last_idx];
 
-        update_bucket_pointer(m_entries[entry_idx_to_remove].first, last_idx, entry_idx_to_remove);
+        update_bucket_pointer(entry_hash(entry_idx_to_remove), last_idx, entry_idx_to_remove);
       }
 
       m_entries.pop();
+      if constexpr (HashCacheT::ENABLED)
+        m_hashes.pop();
     }
 
-    void backward_shift(u32 hole_idx)
+    // A bucket can go straight back to EMPTY when no probe could ever have walked past
+    // it, i.e. it is not inside a run of GROUP_WIDTH non-empty buckets. Otherwise it
+    // becomes a tombstone so that longer probe chains stay intact.
+    void erase_ctrl(usize slot)
     {
-      u32 next = (hole_idx + 1) & m_mask;
-
-      while (true)
-      {
-        u32 entry_idx = m_buckets[next];
-
-        if (entry_idx == INDEX_INVALID)
-          break;
-
-        auto h = hash_key(m_entries[entry_idx].first);
-        auto ideal_idx = h & m_mask;
+      const usize before = (slot - ctrl::GROUP_WIDTH) & m_mask;
+      const auto empty_after = CtrlGroup(m_ctrl.data() + slot).match_empty();
+      const auto empty_before = CtrlGroup(m_ctrl.data() + before).match_empty();
 
-        auto dist_current = (next - ideal_idx) & m_mask;
-        auto dist_hole = (hole_idx - ideal_idx) & m_mask;
+      const bool was_never_full = empty_before && empty_after &&
+                                  (empty_after.trailing_zeros() + empty_before.leading_zeros()) < ctrl::GROUP_WIDTH;
 
-        if (dist_hole < dist_current)
-        {
-          m_buckets[hole_idx] = entry_idx;
-          hole_idx = next;
-        }
-
-        next = (next + 1) & m_mask;
+      if (was_never_full)
+      {
+        set_ctrl(slot, ctrl::EMPTY);
+      }
+      else
+      {
+        set_ctrl(slot, ctrl::DELETED);
+        m_tombstones++;
       }
-
-      m_buckets[hole_idx] = INDEX_INVALID;
     }
 
-    void update_bucket_pointer(const K &key, u32 old_idx, u32 new_idx)
+    void update_bucket_pointer(u64 h, u32 old_idx, u32 new_idx)
     {
-      auto h = hash_key(key);
-      auto idx = h & m_mask;
+      ProbeSeq seq(h, m_mask);
+      const u8 h2 = ctrl::h2(h);
 
       while (true)
       {
-        if (m_buckets[idx] == old_idx)
+        const CtrlGroup group(m_ctrl.data() + seq.offset());
+
+        for (auto match = group.match(h2); match; match.clear_lowest())
         {
-          m_buckets[idx] = new_idx;
-          return;
+          const usize slot = seq.offset(match.lowest());
+          if (m_buckets[slot] == old_idx)
+          {
+            m_buckets[slot] = new_idx;
+            return;
+          }
         }
-        idx = (idx + 1) & m_mask;
+
+        seq.next();
       }
     }
   };
@@ -384,4 +625,7 @@ private:
 namespace au
 {
   template<typename K, typename V> using HashMap = containers::HashMap<K, V>;
+  template<typename K, typename V>
+  using CachedHashMap = containers::HashMap<K, V, containers::Hash<K>, containers::EqualTo<K>, memory::HeapAllocator,
+                                            containers::HashCache32>;
 }
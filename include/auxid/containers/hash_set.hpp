@@ -27,8 +27,8 @@ namespace au::containers
         iterators and pointers like vector::erase, NOT like std::unordered_set::erase.
   */
   template<typename K, typename Hasher = Hash<K>, typename KeyEq = EqualTo<K>,
-           typename AllocatorT = memory::HeapAllocator>
-    requires memory::AllocatorType<AllocatorT>
+           typename AllocatorT = memory::HeapAllocator, typename HashCacheT = NoHashCache>
+    requires memory::AllocatorType<AllocatorT> && HashCachePolicy<HashCacheT>
   class HashSet
   {
 public:
@@ -45,11 +45,25 @@ public:
     using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
 private:
+    static constexpr usize SLOT_INVALID = static_cast<usize>(-1);
+
+    using hash_type = typename HashCacheT::hash_type;
+
+    struct NoCachedHashes
+    {
+    };
+
     VecT<value_type, usize, AllocatorT> m_entries;
+    // Parallel to m_entries when HashCacheT::ENABLED.
+    AUXID_NO_UNIQUE_ADDRESS std::conditional_t<HashCacheT::ENABLED, VecT<hash_type, usize, AllocatorT>, NoCachedHashes>
+        m_hashes;
     VecT<u32, usize, AllocatorT> m_buckets;
+    // One control byte per bucket, followed by a copy of the first GROUP_WIDTH
+    // bytes so a group can be loaded at any bucket without wrapping.
+    VecT<u8, usize, AllocatorT> m_ctrl;
 
     size_type m_mask = 0;
-    size_type m_max_probe_dist = 0;
+    size_type m_tombstones = 0;
 
     Hasher m_hasher;
     KeyEq m_eq;
@@ -64,14 +78,28 @@ public:
       reserve(cap);
     }
 
+    // For stateful allocators (arenas, first-class heaps); every internal array uses it.
+    explicit HashSet(AllocatorT allocator) : m_entries(allocator), m_buckets(allocator), m_ctrl(allocator)
+    {
+      if constexpr (HashCacheT::ENABLED)
+        m_hashes = VecT<hash_type, usize, AllocatorT>(allocator);
+    }
+
+    [[nodiscard]] const AllocatorT &get_allocator() const
+    {
+      return m_entries.get_allocator();
+    }
+
 public:
     void reserve(size_type new_cap)
     {
       if (new_cap <= m_entries.capacity())
         return;
       m_entries.reserve(new_cap);
+      if constexpr (HashCacheT::ENABLED)
+        m_hashes.reserve(new_cap);
 
-      size_type buckets_cap = 8;
+      size_type buckets_cap = ctrl::GROUP_WIDTH;
       while (buckets_cap < new_cap * 2)
         buckets_cap *= 2;
       rehash_buckets(buckets_cap);
@@ -80,79 +108,59 @@ public:
     void clear()
     {
       m_entries.clear();
-      if (!m_buckets.empty())
+      if constexpr (HashCacheT::ENABLED)
+        m_hashes.clear();
+      if (!m_ctrl.empty())
       {
-        std::fill(m_buckets.begin(), m_buckets.end(), INDEX_INVALID);
+        std::fill(m_ctrl.begin(), m_ctrl.end(), ctrl::EMPTY);
       }
+      m_tombstones = 0;
     }
 
     bool insert(const K &key)
     {
-      if (contains(key))
+      const auto h = hash_key(key);
+      if (find_slot(key, h) != SLOT_INVALID)
         return false;
 
-      if (should_grow())
-        grow();
-
-      u32 entry_idx = static_cast<u32>(m_entries.size());
+      prepare_insert(h);
       m_entries.push(value_type{key});
-
-      insert_into_buckets(entry_idx, key);
       return true;
     }
 
     bool contains(const K &key)
     {
-      if (m_buckets.empty())
-        return false;
-
-      auto h = hash_key(key);
-      auto idx = h & m_mask;
-      auto dist = 0;
-
-      while (true)
-      {
-        u32 entry_idx = m_buckets[idx];
-
-        if (entry_idx == INDEX_INVALID)
-          return false;
-
-        if (m_eq(m_entries[entry_idx], key))
-        {
-          return true;
-        }
-
-        dist++;
-        idx = (idx + 1) & m_mask;
-
-        if (dist > (i32) m_mask)
-          return false;
-      }
+      return find_slot(key, hash_key(key)) != SLOT_INVALID;
     }
 
     bool erase(const K &key)
     {
-      if (m_buckets.empty())
+      const usize slot = find_slot(key, hash_key(key));
+      if (slot == SLOT_INVALID)
         return false;
 
-      auto h = hash_key(key);
-      auto idx = h & m_mask;
-
-      while (true)
-      {
-        u32 entry_idx = m_buckets[idx];
+      remove_at_bucket(slot);
+      return true;
+    }
 
-        if (entry_idx == INDEX_INVALID)
-          return false;
+    // Heterogeneous lookup, see HashMap.
+    template<typename Q>
+      requires TransparentLookup<Hasher, KeyEq>
+    bool contains(const Q &key)
+    {
+      return find_slot(key, hash_key(key)) != SLOT_INVALID;
+    }
 
-        if (m_eq(m_entries[entry_idx], key))
-        {
-          remove_at_bucket(idx, entry_idx);
-          return true;
-        }
+    template<typename Q>
+      requires TransparentLookup<Hasher, KeyEq>
+    bool erase(const Q &key)
+    {
+      const usize slot = find_slot(key, hash_key(key));
+      if (slot == SLOT_INVALID)
+        return false;
 
-        idx = (idx + 1) & m_mask;
-      }
+      remove_at_bucket(slot);
+      return true;
     }
 
     value_type *begin()
@@ -226,108 +234,201 @@ public:
     }
 
 private:
-    u64 hash_key(const K &key) const
+    template<typename Q> hash_type hash_key(const Q &key) const
     {
-      return m_hasher(key);
+      return static_cast<hash_type>(m_hasher(key));
+    }
+
+    hash_type entry_hash(u32 entry_idx) const
+    {
+      if constexpr (HashCacheT::ENABLED)
+        return m_hashes[entry_idx];
+      else
+        return hash_key(m_entries[entry_idx]);
     }
 
     [[nodiscard]] bool should_grow() const
     {
-      return m_entries.size() * 10 >= m_buckets.size() * 8 || m_buckets.empty();
+      return (m_entries.size() + m_tombstones) * 10 >= m_buckets.size() * 8 || m_buckets.empty();
     }
 
     void grow()
     {
-      size_type new_cap = (m_buckets.empty()) ? 16 : m_buckets.size() * 2;
-      rehash_buckets(new_cap);
+      if (m_buckets.empty())
+        rehash_buckets(ctrl::GROUP_WIDTH);
+      // Mostly tombstones: rebuild at the same size to reclaim them.
+      else if (m_entries.size() * 10 < m_buckets.size() * 4)
+        rehash_buckets(m_buckets.size());
+      else
+        rehash_buckets(m_buckets.size() * 2);
     }
 
     void rehash_buckets(size_type new_cap)
     {
+      m_ctrl.clear();
+      m_ctrl.reserve(new_cap + ctrl::GROUP_WIDTH);
+      m_ctrl.resize(new_cap + ctrl::GROUP_WIDTH, ctrl::EMPTY);
+
       m_buckets.clear();
       m_buckets.reserve(new_cap);
 
       m_buckets.resize(new_cap, INDEX_INVALID);
 
       m_mask = new_cap - 1;
+      m_tombstones = 0;
 
       for (u32 i = 0; i < m_entries.size(); ++i)
       {
-        insert_into_buckets(i, m_entries[i]);
+        insert_into_buckets(i, entry_hash(i));
+      }
+    }
+
+    void set_ctrl(usize slot, u8 c)
+    {
+      m_ctrl[slot] = c;
+      if (slot < ctrl::GROUP_WIDTH)
+        m_ctrl[slot + m_buckets.size()] = c;
+    }
+
+    template<typename Q> [[nodiscard]] usize find_slot(const Q &key, u64 h) const
+    {
+      if (m_buckets.empty())
+        return SLOT_INVALID;
+
+      ProbeSeq seq(h, m_mask);
+      const u8 h2 = ctrl::h2(h);
+
+      while (true)
+      {
+        const CtrlGroup group(m_ctrl.data() + seq.offset());
+
+        for (auto match = group.match(h2); match; match.clear_lowest())
+        {
+          const usize slot = seq.offset(match.lowest());
+          const u32 entry_idx = m_buckets[slot];
+
+          if constexpr (HashCacheT::ENABLED)
+          {
+            if (m_hashes[entry_idx] != h)
+              continue;
+          }
+
+          if (m_eq(m_entries[entry_idx], key))
+            return slot;
+        }
+
+        if (group.match_empty())
+          return SLOT_INVALID;
+
+        seq.next();
+
+        if (seq.index() > m_mask)
+          return SLOT_INVALID;
       }
     }
 
-    void insert_into_buckets(u32 entry_idx, const K &key)
+    [[nodiscard]] usize find_free_slot(u64 h) const
     {
-      auto h = hash_key(key);
-      auto idx = h & m_mask;
+      ProbeSeq seq(h, m_mask);
 
-      while (m_buckets[idx] != INDEX_INVALID)
+      while (true)
       {
-        idx = (idx + 1) & m_mask;
+        const auto match = CtrlGroup(m_ctrl.data() + seq.offset()).match_empty_or_deleted();
+        if (match)
+          return seq.offset(match.lowest());
+
+        seq.next();
       }
+    }
 
-      m_buckets[idx] = entry_idx;
+    // Claims a bucket for the entry about to be pushed to the back of m_entries.
+    void prepare_insert(u64 h)
+    {
+      if (should_grow())
+        grow();
+
+      insert_into_buckets(static_cast<u32>(m_entries.size()), h);
+
+      if constexpr (HashCacheT::ENABLED)
+        m_hashes.push(static_cast<hash_type>(h));
+    }
+
+    void insert_into_buckets(u32 entry_idx, u64 h)
+    {
+      const usize slot = find_free_slot(h);
+
+      if (m_ctrl[slot] == ctrl::DELETED)
+        m_tombstones--;
+
+      set_ctrl(slot, ctrl::h2(h));
+      m_buckets[slot] = entry_idx;
     }
 
-    void remove_at_bucket(u32 bucket_idx, u32 entry_idx_to_remove)
+    void remove_at_bucket(usize bucket_idx)
     {
-      backward_shift(bucket_idx);
+      const u32 entry_idx_to_remove = m_buckets[bucket_idx];
+
+      erase_ctrl(bucket_idx);
 
       u32 last_idx = static_cast<u32>(m_entries.size() - 1);
 
       if (entry_idx_to_remove != last_idx)
       {
         m_entries[entry_idx_to_remove] = std::move(m_entries[last_idx]);
+        if constexpr (HashCacheT::ENABLED)
+          m_hashes[entry_idx_to_remove] = m_hashes[last_idx];
 
-        update_bucket_pointer(m_entries[entry_idx_to_remove], last_idx, entry_idx_to_remove);
+        update_bucket_pointer(entry_hash(entry_idx_to_remove), last_idx, entry_idx_to_remove);
       }
 
       m_entries.pop();
+      if constexpr (HashCacheT::ENABLED)
+        m_hashes.pop();
     }
 
-    void backward_shift(u32 hole_idx)
+    // A bucket can go straight back to EMPTY when no probe could ever have walked past
+    // it, i.e. it is not inside a run of GROUP_WIDTH non-empty buckets. Otherwise it
+    // becomes a tombstone so that longer probe chains stay intact.
+    void erase_ctrl(usize slot)
     {
-      u32 next = (hole_idx + 1) & m_mask;
-
-      while (true)
-      {
-        u32 entry_idx = m_buckets[next];
+      const usize before = (slot - ctrl::GROUP_WIDTH) & m_mask;
+      const auto empty_after = CtrlGroup(m_ctrl.data() + slot).match_empty();
+      const auto empty_before = CtrlGroup(m_ctrl.data() + before).match_empty();
 
-        if (entry_idx == INDEX_INVALID)
-          break;
+      const bool was_never_full = empty_before && empty_after &&
+                                  (empty_after.trailing_zeros() + empty_before.leading_zeros()) < ctrl::GROUP_WIDTH;
 
-        auto h = hash_key(m_entries[entry_idx]);
-        auto ideal_idx = h & m_mask;
-
-        auto dist_current = (next - ideal_idx) & m_mask;
-        auto dist_hole = (hole_idx - ideal_idx) & m_mask;
-
-        if (dist_hole < dist_current)
-        {
-          m_buckets[hole_idx] = entry_idx;
-          hole_idx = next;
-        }
-
-        next = (next + 1) & m_mask;
+      if (was_never_full)
+      {
+        set_ctrl(slot, ctrl::EMPTY);
+      }
+      else
+      {
+        set_ctrl(slot, ctrl::DELETED);
+        m_tombstones++;
       }
-
-      m_buckets[hole_idx] = INDEX_INVALID;
     }
 
-    void update_bucket_pointer(const K &key, u32 old_idx, u32 new_idx)
+    void update_bucket_pointer(u64 h, u32 old_idx, u32 new_idx)
     {
-      auto h = hash_key(key);
-      auto idx = h & m_mask;
+      ProbeSeq seq(h, m_mask);
+      const u8 h2 = ctrl::h2(h);
 
       while (true)
       {
-        if (m_buckets[idx] == old_idx)
+        const CtrlGroup group(m_ctrl.data() + seq.offset());
+
+        for (auto match = group.match(h2); match; match.clear_lowest())
         {
-          m_buckets[idx] = new_idx;
-          return;
+          const usize slot = seq.offset(match.lowest());
+          if (m_buckets[slot] == old_idx)
+          {
+            m_buckets[slot] = new_idx;
+            return;
+          }
         }
-        idx = (idx + 1) & m_mask;
+
+        seq.next();
       }
     }
   };
@@ -336,4 +437,7 @@ private:
 namespace au
 {
   template<typename T> using HashSet = containers::HashSet<T>;
+  template<typename T>
+  using CachedHashSet =
+      containers::HashSet<T, containers::Hash<T>, containers::EqualTo<T>, memory::HeapAllocator, containers::HashCache32>;
 }
\ No newline at end of file
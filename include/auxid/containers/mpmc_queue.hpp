@@ -0,0 +1,427 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <auxid/memory/heap.hpp>
+#include <auxid/result.hpp>
+
+#include <atomic>
+#include <utility>
+
+namespace au::containers
+{
+  namespace mpmc
+  {
+    inline constexpr usize CACHE_LINE = 64;
+
+    // One slot per cache line, so neighbouring producers and consumers never share one.
+    // `sequence` says whose turn the cell is: == pos for the producer of position pos,
+    // == pos + 1 for its consumer.
+    template<typename T> struct alignas(CACHE_LINE) Cell
+    {
+      std::atomic<usize> sequence;
+      alignas(T) u8 storage[sizeof(T)];
+
+      T *value()
+      {
+        return reinterpret_cast<T *>(storage);
+      }
+    };
+
+    // Dmitry Vyukov's bounded MPMC algorithm over a power-of-two array of cells. The cells
+    // are passed in, so the fixed and the heap-backed queue share it.
+    template<typename T> class Ring
+    {
+      alignas(CACHE_LINE) std::atomic<usize> m_enqueue_pos{0};
+      alignas(CACHE_LINE) std::atomic<usize> m_dequeue_pos{0};
+
+  public:
+      static void init(Cell<T> *cells, usize capacity)
+      {
+        for (usize i = 0; i < capacity; ++i)
+          cells[i].sequence.store(i, std::memory_order_relaxed);
+      }
+
+      template<typename U> bool try_push(Cell<T> *cells, usize mask, U &&value)
+      {
+        usize pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        while (true)
+        {
+          Cell<T> &cell = cells[pos & mask];
+          const usize seq = cell.sequence.load(std::memory_order_acquire);
+          const isize diff = static_cast<isize>(seq - pos);
+          if (diff == 0)
+          {
+            if (m_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+              new (cell.value()) T(std::forward<U>(value));
+              cell.sequence.store(pos + 1, std::memory_order_release);
+              return true;
+            }
+          }
+          else if (diff < 0)
+          {
+            return false;
+          }
+          else
+          {
+            pos = m_enqueue_pos.load(std::memory_order_relaxed);
+          }
+        }
+      }
+
+      bool try_pop(Cell<T> *cells, usize mask, T &out_value)
+      {
+        usize pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        while (true)
+        {
+          Cell<T> &cell = cells[pos & mask];
+          const usize seq = cell.sequence.load(std::memory_order_acquire);
+          const isize diff = static_cast<isize>(seq - (pos + 1));
+          if (diff == 0)
+          {
+            if (m_dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+              take(cell, pos, mask, out_value);
+              return true;
+            }
+          }
+          else if (diff < 0)
+          {
+            return false;
+          }
+          else
+          {
+            pos = m_dequeue_pos.load(std::memory_order_relaxed);
+          }
+        }
+      }
+
+      // Claims up to `count` consecutive free cells with a single CAS, then moves values in.
+      usize try_push_bulk(Cell<T> *cells, usize mask, T *values, usize count)
+      {
+        if (count == 0)
+          return 0;
+
+        usize pos = m_enqueue_pos.load(std::memory_order_relaxed);
+        while (true)
+        {
+          const usize n = claimable(cells, mask, pos, count, 0);
+          if (n == 0)
+          {
+            const usize seq = cells[pos & mask].sequence.load(std::memory_order_acquire);
+            if (static_cast<isize>(seq - pos) < 0)
+              return 0;
+            pos = m_enqueue_pos.load(std::memory_order_relaxed);
+            continue;
+          }
+
+          if (m_enqueue_pos.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed))
+          {
+            for (usize i = 0; i < n; ++i)
+            {
+              Cell<T> &cell = cells[(pos + i) & mask];
+              new (cell.value()) T(std::move(values[i]));
+              cell.sequence.store(pos + i + 1, std::memory_order_release);
+            }
+            return n;
+          }
+        }
+      }
+
+      usize try_pop_bulk(Cell<T> *cells, usize mask, T *out_values, usize max_count)
+      {
+        if (max_count == 0)
+          return 0;
+
+        usize pos = m_dequeue_pos.load(std::memory_order_relaxed);
+        while (true)
+        {
+          const usize n = claimable(cells, mask, pos, max_count, 1);
+          if (n == 0)
+          {
+            const usize seq = cells[pos & mask].sequence.load(std::memory_order_acquire);
+            if (static_cast<isize>(seq - (pos + 1)) < 0)
+              return 0;
+            pos = m_dequeue_pos.load(std::memory_order_relaxed);
+            continue;
+          }
+
+          if (m_dequeue_pos.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed))
+          {
+            for (usize i = 0; i < n; ++i)
+              take(cells[(pos + i) & mask], pos + i, mask, out_values[i]);
+            return n;
+          }
+        }
+      }
+
+      // Exact only while no other thread is pushing or popping.
+      [[nodiscard]] usize size_approx() const
+      {
+        const usize dequeue = m_dequeue_pos.load(std::memory_order_relaxed);
+        const usize enqueue = m_enqueue_pos.load(std::memory_order_relaxed);
+        return enqueue > dequeue ? enqueue - dequeue : 0;
+      }
+
+      // Destroys whatever is still queued. No other thread may be using the queue.
+      void drain(Cell<T> *cells, usize mask)
+      {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+          const usize end = m_enqueue_pos.load(std::memory_order_relaxed);
+          for (usize pos = m_dequeue_pos.load(std::memory_order_relaxed); pos != end; ++pos)
+            cells[pos & mask].value()->~T();
+        }
+      }
+
+  private:
+      // Number of cells from `pos` (at most `limit`) whose sequence is pos + i + `turn`. A
+      // cell in that state can only change hands by first moving the claimed position
+      // past it, which the caller's CAS on that position detects.
+      static usize claimable(Cell<T> *cells, usize mask, usize pos, usize limit, usize turn)
+      {
+        usize n = 0;
+        while (n < limit && n <= mask &&
+               cells[(pos + n) & mask].sequence.load(std::memory_order_acquire) == pos + n + turn)
+          ++n;
+        return n;
+      }
+
+      static void take(Cell<T> &cell, usize pos, usize mask, T &out_value)
+      {
+        T *value = cell.value();
+        out_value = std::move(*value);
+        value->~T();
+        cell.sequence.store(pos + mask + 1, std::memory_order_release);
+      }
+    };
+  } // namespace mpmc
+
+  /*
+  NOTE: Bounded lock-free multi-producer/multi-consumer queue (Vyukov): each cell carries
+        a sequence number, so producers and consumers only contend on the CAS of their
+        own position counter, never on a lock. Both operations fail instead of blocking
+        when the queue is full or empty.
+
+        The batched variants claim a run of cells with one CAS, which amortizes the
+        contended counter when moving many items at once.
+  */
+  template<typename T, usize Capacity>
+    requires((Capacity >= 2) && ((Capacity & (Capacity - 1)) == 0))
+  class MpmcQueue
+  {
+    static constexpr usize K_MASK = Capacity - 1;
+
+    mpmc::Ring<T> m_ring;
+    mpmc::Cell<T> m_cells[Capacity];
+
+public:
+    MpmcQueue()
+    {
+      mpmc::Ring<T>::init(m_cells, Capacity);
+    }
+
+    ~MpmcQueue()
+    {
+      m_ring.drain(m_cells, K_MASK);
+    }
+
+    MpmcQueue(const MpmcQueue &) = delete;
+    MpmcQueue &operator=(const MpmcQueue &) = delete;
+
+public:
+    [[nodiscard]] bool try_push(const T &value)
+    {
+      return m_ring.try_push(m_cells, K_MASK, value);
+    }
+
+    [[nodiscard]] bool try_push(T &&value)
+    {
+      return m_ring.try_push(m_cells, K_MASK, std::move(value));
+    }
+
+    [[nodiscard]] bool try_pop(T &out_value)
+    {
+      return m_ring.try_pop(m_cells, K_MASK, out_value);
+    }
+
+    // Moves a prefix of `values` in; returns how many were taken (0 when full).
+    [[nodiscard]] usize try_push_bulk(Span<T> values)
+    {
+      return m_ring.try_push_bulk(m_cells, K_MASK, values.data(), values.size());
+    }
+
+    // Pops into a prefix of `out_values`; returns how many were written (0 when empty).
+    [[nodiscard]] usize try_pop_bulk(Span<T> out_values)
+    {
+      return m_ring.try_pop_bulk(m_cells, K_MASK, out_values.data(), out_values.size());
+    }
+
+    [[nodiscard]] usize size_approx() const
+    {
+      return m_ring.size_approx();
+    }
+
+    [[nodiscard]] static constexpr usize capacity()
+    {
+      return Capacity;
+    }
+  };
+
+  /*
+  NOTE: MpmcQueue with its capacity chosen at runtime (rounded up to a power of two). The
+        counters and cells live in one block from AllocatorT, so the queue itself is a
+        movable handle; moving it while other threads use it is not allowed.
+  */
+  template<typename T, typename AllocatorT = memory::HeapAllocator>
+    requires memory::AllocatorType<AllocatorT>
+  class DynamicMpmcQueue
+  {
+    // The counters sit in front of the cells, padded to a whole cell so cells stay aligned.
+    static constexpr usize HEADER_SIZE =
+        (sizeof(mpmc::Ring<T>) + alignof(mpmc::Cell<T>) - 1) & ~(alignof(mpmc::Cell<T>) - 1);
+    static constexpr usize BLOCK_ALIGN = alignof(mpmc::Cell<T>);
+
+    u8 *m_block = nullptr;
+    usize m_mask = 0;
+    AUXID_NO_UNIQUE_ADDRESS AllocatorT m_allocator;
+
+public:
+    DynamicMpmcQueue(const DynamicMpmcQueue &) = delete;
+    DynamicMpmcQueue &operator=(const DynamicMpmcQueue &) = delete;
+
+    DynamicMpmcQueue(DynamicMpmcQueue &&other) noexcept
+        : m_block(other.m_block), m_mask(other.m_mask), m_allocator(std::move(other.m_allocator))
+    {
+      other.m_block = nullptr;
+    }
+
+    DynamicMpmcQueue &operator=(DynamicMpmcQueue &&other) noexcept
+    {
+      if (this != &other)
+      {
+        release();
+        m_block = other.m_block;
+        m_mask = other.m_mask;
+        m_allocator = std::move(other.m_allocator);
+        other.m_block = nullptr;
+      }
+      return *this;
+    }
+
+    ~DynamicMpmcQueue()
+    {
+      release();
+    }
+
+    static auto create(usize requested_capacity, AllocatorT allocator = AllocatorT()) -> Result<DynamicMpmcQueue>
+    {
+      if (requested_capacity == 0 || requested_capacity > (usize(1) << 40))
+        return fail("DynamicMpmcQueue: invalid capacity %zu", requested_capacity);
+
+      usize capacity = 2;
+      while (capacity < requested_capacity)
+        capacity *= 2;
+
+      u8 *block = static_cast<u8 *>(allocator.alloc(block_size(capacity), BLOCK_ALIGN));
+      if (!block)
+        return fail("DynamicMpmcQueue: failed to allocate %zu cells", capacity);
+
+      new (block) mpmc::Ring<T>();
+      auto *cells = reinterpret_cast<mpmc::Cell<T> *>(block + HEADER_SIZE);
+      for (usize i = 0; i < capacity; ++i)
+        new (&cells[i]) mpmc::Cell<T>();
+      mpmc::Ring<T>::init(cells, capacity);
+
+      return DynamicMpmcQueue(block, capacity - 1, std::move(allocator));
+    }
+
+public:
+    [[nodiscard]] bool try_push(const T &value)
+    {
+      return ring().try_push(cells(), m_mask, value);
+    }
+
+    [[nodiscard]] bool try_push(T &&value)
+    {
+      return ring().try_push(cells(), m_mask, std::move(value));
+    }
+
+    [[nodiscard]] bool try_pop(T &out_value)
+    {
+      return ring().try_pop(cells(), m_mask, out_value);
+    }
+
+    [[nodiscard]] usize try_push_bulk(Span<T> values)
+    {
+      return ring().try_push_bulk(cells(), m_mask, values.data(), values.size());
+    }
+
+    [[nodiscard]] usize try_pop_bulk(Span<T> out_values)
+    {
+      return ring().try_pop_bulk(cells(), m_mask, out_values.data(), out_values.size());
+    }
+
+    [[nodiscard]] usize size_approx() const
+    {
+      return reinterpret_cast<const mpmc::Ring<T> *>(m_block)->size_approx();
+    }
+
+    [[nodiscard]] usize capacity() const
+    {
+      return m_mask + 1;
+    }
+
+private:
+    DynamicMpmcQueue(u8 *block, usize mask, AllocatorT allocator)
+        : m_block(block), m_mask(mask), m_allocator(std::move(allocator))
+    {
+    }
+
+    static usize block_size(usize capacity)
+    {
+      return HEADER_SIZE + capacity * sizeof(mpmc::Cell<T>);
+    }
+
+    mpmc::Ring<T> &ring()
+    {
+      return *reinterpret_cast<mpmc::Ring<T> *>(m_block);
+    }
+
+    mpmc::Cell<T> *cells()
+    {
+      return reinterpret_cast<mpmc::Cell<T> *>(m_block + HEADER_SIZE);
+    }
+
+    void release()
+    {
+      if (!m_block)
+        return;
+      ring().drain(cells(), m_mask);
+      ring().~Ring();
+      m_allocator.free(m_block, block_size(m_mask + 1), BLOCK_ALIGN);
+      m_block = nullptr;
+    }
+  };
+} // namespace au::containers
+
+namespace au
+{
+  template<typename T, usize Capacity> using MpmcQueue = containers::MpmcQueue<T, Capacity>;
+  template<typename T> using DynamicMpmcQueue = containers::DynamicMpmcQueue<T>;
+} // namespace au
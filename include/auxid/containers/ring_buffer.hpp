@@ -204,6 +204,26 @@ public:
       return m_view.pop(out_header, out_buffer);
     }
 
+    auto reserve(const u16 packet_id, const u32 size) -> Result<Span<u8>>
+    {
+      return m_view.reserve(packet_id, size);
+    }
+
+    auto commit(const u32 size) -> Result<void>
+    {
+      return m_view.commit(size);
+    }
+
+    auto peek() -> Option<PacketView>
+    {
+      return m_view.peek();
+    }
+
+    auto release() -> Result<void>
+    {
+      return m_view.release();
+    }
+
     auto get_view() -> DynamicRingBufferView &
     {
       return m_view;
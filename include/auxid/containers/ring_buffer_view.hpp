@@ -16,6 +16,7 @@
 #pragma once
 
 #include <auxid/result.hpp>
+#include <auxid/containers/option.hpp>
 #include <auxid/containers/vec.hpp>
 
 #include <atomic>
@@ -44,12 +45,42 @@ namespace au::containers
     u16 payload_size{0};
   };
 
+  // A packet read in place by DynamicRingBufferView::peek; valid until release().
+  struct PacketView
+  {
+    PacketHeader header;
+    Span<const u8> payload;
+  };
+
+  /*
+  NOTE: push/pop copy packets in and out. The zero-copy pair works on the mirrored region
+        directly, which is contiguous across the wrap point: the producer calls reserve,
+        serializes into the returned span and then commit; the consumer calls peek, parses
+        the payload in place and then release. Only one reservation (producer) and one
+        peeked packet (consumer) may be outstanding at a time.
+
+        The reservation is remembered on the producer's side of the view: commit() fails
+        without one (or a second time for the same one) instead of publishing stale ring
+        bytes, and push() fails while one is outstanding.
+  */
   class DynamicRingBufferView
   {
 public:
     auto pop(PacketHeader &out_header, Span<u8> out_buffer) -> Result<usize>;
     auto push(const u16 packet_id, Span<const u8> data) -> Result<void>;
 
+    // Returns `size` writable bytes for the payload of packet `packet_id`, or fails if
+    // they do not fit. Nothing is visible to the consumer until commit().
+    auto reserve(const u16 packet_id, const u32 size) -> Result<Span<u8>>;
+    // Publishes the reserved packet with its first `size` payload bytes (at most the
+    // reserved size).
+    auto commit(const u32 size) -> Result<void>;
+
+    // The oldest packet, without copying it out, or None if the buffer is empty.
+    auto peek() -> Option<PacketView>;
+    // Drops the packet returned by the last peek().
+    auto release() -> Result<void>;
+
 protected:
     // `data` must point to a *mirrored memory region* of size (capacity * 2) + sizeof(ControlBlock)
     DynamicRingBufferView(ControlBlock *cb, u8 *data, u32 cap) : m_control_block(cb), m_data_ptr(data), m_capacity(cap)
@@ -59,6 +90,8 @@ protected:
     Mut<u8 *> m_data_ptr{};
     Mut<u32> m_capacity{};
     Mut<ControlBlock *> m_control_block{};
+    // Producer-side only: the packet between reserve() and commit().
+    Mut<Option<PacketHeader>> m_reservation{};
 
     auto write_mirrored(const u32 offset, const void *data, const u32 size) -> void
     {
@@ -70,11 +103,20 @@ protected:
       std::memcpy(out_data, m_data_ptr + (offset & (m_capacity - 1)), size);
     }
 
+    auto at_mirrored(const u32 offset) -> u8 *
+    {
+      return m_data_ptr + (offset & (m_capacity - 1));
+    }
+
     friend class DynamicRingBuffer;
+    friend class SharedRingBuffer;
   };
 
   inline auto DynamicRingBufferView::push(const u16 packet_id, Span<const u8> data) -> Result<void>
   {
+    if (m_reservation.is_some())
+      return fail("Cannot push while a reservation is outstanding");
+
     const u32 total_size = sizeof(PacketHeader) + static_cast<u32>(data.size());
     if (total_size > m_capacity)
       return fail("Packet larger than buffer capacity");
@@ -124,6 +166,77 @@ protected:
 
     return static_cast<usize>(sizeof(PacketHeader) + out_header.payload_size);
   }
+
+  inline auto DynamicRingBufferView::reserve(const u16 packet_id, const u32 size) -> Result<Span<u8>>
+  {
+    if (size > UINT16_MAX)
+      return fail("Packet payload larger than 65535 bytes");
+
+    const u32 total_size = sizeof(PacketHeader) + size;
+    if (total_size > m_capacity)
+      return fail("Packet larger than buffer capacity");
+
+    const u32 write = m_control_block->producer.write_offset.load(std::memory_order_relaxed);
+    const u32 read = m_control_block->consumer.read_offset.load(std::memory_order_acquire);
+
+    if (m_capacity - (write - read) < total_size)
+      return fail("Buffer full. Cannot reserve packet.");
+
+    // The header is written by commit(); the consumer cannot see anything past the write
+    // offset until then.
+    m_reservation = Option<PacketHeader>(PacketHeader{packet_id, static_cast<u16>(size)});
+
+    return Span<u8>(at_mirrored(write + sizeof(PacketHeader)), size);
+  }
+
+  inline auto DynamicRingBufferView::commit(const u32 size) -> Result<void>
+  {
+    if (m_reservation.is_none())
+      return fail("Commit without a matching reserve");
+
+    PacketHeader header = *m_reservation;
+    if (size > header.payload_size)
+      return fail("Commit larger than the reserved size");
+
+    const u32 write = m_control_block->producer.write_offset.load(std::memory_order_relaxed);
+    header.payload_size = static_cast<u16>(size);
+    write_mirrored(write, &header, sizeof(PacketHeader));
+    m_reservation = nullopt;
+
+    m_control_block->producer.write_offset.store(write + sizeof(PacketHeader) + size, std::memory_order_release);
+    return {};
+  }
+
+  inline auto DynamicRingBufferView::peek() -> Option<PacketView>
+  {
+    const u32 read = m_control_block->consumer.read_offset.load(std::memory_order_relaxed);
+    const u32 write = m_control_block->producer.write_offset.load(std::memory_order_acquire);
+
+    if (read == write)
+      return nullopt;
+
+    PacketView view;
+    read_mirrored(read, &view.header, sizeof(PacketHeader));
+    view.payload = Span<const u8>(at_mirrored(read + sizeof(PacketHeader)), view.header.payload_size);
+    return view;
+  }
+
+  inline auto DynamicRingBufferView::release() -> Result<void>
+  {
+    u32 read = m_control_block->consumer.read_offset.load(std::memory_order_relaxed);
+    const u32 write = m_control_block->producer.write_offset.load(std::memory_order_acquire);
+
+    if (read == write)
+      return fail("Nothing to release");
+
+    PacketHeader header;
+    read_mirrored(read, &header, sizeof(PacketHeader));
+
+    const u32 new_read = read + sizeof(PacketHeader) + header.payload_size;
+    m_control_block->consumer.read_offset.compare_exchange_strong(read, new_read, std::memory_order_release,
+                                                                  std::memory_order_relaxed);
+    return {};
+  }
 } // namespace au::containers
 
 namespace au::containers
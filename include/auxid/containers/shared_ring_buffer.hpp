@@ -0,0 +1,166 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <auxid/containers/ring_buffer_view.hpp>
+#include <auxid/containers/string.hpp>
+
+namespace au::containers
+{
+  /*
+  NOTE: DynamicRingBuffer in shared memory, for streaming packets between processes on one
+        host. A single shared object holds the ControlBlock in its first page (allocation
+        granule on Windows) followed by the data, and every process maps the data twice
+        back to back so views stay contiguous across the wrap point, as in
+        MirroredAllocator.
+
+        create() makes a named object (POSIX: a shm_open name such as "/telemetry") and
+        open() attaches to it by name. On POSIX, create_anonymous() makes an unnamed memfd
+        instead; hand fd() to the other process (fork, SCM_RIGHTS) and attach there with
+        open_fd(). The creator unlinks the name when it is destroyed; processes that are
+        already attached keep working.
+
+        Exactly one process may produce and one consume, as with DynamicRingBufferView.
+  */
+  class SharedRingBuffer
+  {
+public:
+    SharedRingBuffer(const SharedRingBuffer &) = delete;
+    SharedRingBuffer &operator=(const SharedRingBuffer &) = delete;
+
+    SharedRingBuffer(SharedRingBuffer &&other) noexcept
+        : m_base(other.m_base), m_header_size(other.m_header_size), m_capacity(other.m_capacity),
+          m_handle(other.m_handle), m_owned_name(std::move(other.m_owned_name)),
+          m_view(control_block(), m_base + m_header_size, m_capacity)
+    {
+      other.m_base = nullptr;
+      other.m_handle = INVALID_HANDLE;
+    }
+
+    SharedRingBuffer &operator=(SharedRingBuffer &&other) noexcept
+    {
+      if (this != &other)
+      {
+        unmap();
+        m_base = other.m_base;
+        m_header_size = other.m_header_size;
+        m_capacity = other.m_capacity;
+        m_handle = other.m_handle;
+        m_owned_name = std::move(other.m_owned_name);
+        m_view = DynamicRingBufferView(control_block(), m_base + m_header_size, m_capacity);
+
+        other.m_base = nullptr;
+        other.m_handle = INVALID_HANDLE;
+      }
+      return *this;
+    }
+
+    ~SharedRingBuffer()
+    {
+      unmap();
+    }
+
+    static auto create(const char *name, const u32 requested_capacity) -> Result<SharedRingBuffer>;
+    static auto open(const char *name) -> Result<SharedRingBuffer>;
+
+#if !defined(_WIN32)
+    static auto create_anonymous(const u32 requested_capacity) -> Result<SharedRingBuffer>;
+    // Attaches to the ring behind `fd`; the fd is duplicated, the caller keeps its own.
+    static auto open_fd(const int fd) -> Result<SharedRingBuffer>;
+
+    [[nodiscard]] auto fd() const -> int
+    {
+      return static_cast<int>(m_handle);
+    }
+#endif
+
+    auto push(const u16 packet_id, Span<const u8> data) -> Result<void>
+    {
+      return m_view.push(packet_id, data);
+    }
+
+    auto pop(PacketHeader &out_header, Span<u8> out_buffer) -> Result<usize>
+    {
+      return m_view.pop(out_header, out_buffer);
+    }
+
+    auto reserve(const u16 packet_id, const u32 size) -> Result<Span<u8>>
+    {
+      return m_view.reserve(packet_id, size);
+    }
+
+    auto commit(const u32 size) -> Result<void>
+    {
+      return m_view.commit(size);
+    }
+
+    auto peek() -> Option<PacketView>
+    {
+      return m_view.peek();
+    }
+
+    auto release() -> Result<void>
+    {
+      return m_view.release();
+    }
+
+    [[nodiscard]] auto capacity() const -> u32
+    {
+      return m_capacity;
+    }
+
+    auto get_view() -> DynamicRingBufferView &
+    {
+      return m_view;
+    }
+
+private:
+    // fd on POSIX, HANDLE on Windows.
+    static constexpr isize INVALID_HANDLE = -1;
+
+    SharedRingBuffer(u8 *base, u32 header_size, u32 capacity, isize handle, String owned_name)
+        : m_base(base), m_header_size(header_size), m_capacity(capacity), m_handle(handle),
+          m_owned_name(std::move(owned_name)), m_view(control_block(), m_base + m_header_size, m_capacity)
+    {
+    }
+
+    // Both take ownership of `handle` (and unlink `owned_name`) on failure.
+    // Maps an initialized shared object and checks its ControlBlock.
+    static auto attach(isize handle) -> Result<SharedRingBuffer>;
+    // Maps a fresh shared object of header + `capacity` bytes and initializes its ControlBlock.
+    static auto init(isize handle, const u32 capacity, String owned_name) -> Result<SharedRingBuffer>;
+
+    auto control_block() -> ControlBlock *
+    {
+      return reinterpret_cast<ControlBlock *>(m_base);
+    }
+
+    auto unmap() -> void;
+
+    u8 *m_base{nullptr};
+    u32 m_header_size{0};
+    u32 m_capacity{0};
+    isize m_handle{INVALID_HANDLE};
+    // Set on the creator of a named POSIX object, which unlinks it in unmap().
+    String m_owned_name;
+    DynamicRingBufferView m_view;
+  };
+} // namespace au::containers
+
+namespace au
+{
+  using SharedRingBuffer = containers::SharedRingBuffer;
+}
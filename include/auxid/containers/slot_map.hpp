@@ -0,0 +1,246 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <auxid/containers/vec.hpp>
+
+namespace au::containers
+{
+  // Stable reference into a SlotMap. A handle whose element was erased goes stale: lookups
+  // through it fail, even after its slot is reused by a newer element.
+  struct SlotHandle
+  {
+    static constexpr u32 INVALID_INDEX = UINT32_MAX;
+
+    u32 index = INVALID_INDEX;
+    u32 generation = 0;
+
+    [[nodiscard]] bool is_null() const
+    {
+      return index == INVALID_INDEX;
+    }
+
+    bool operator==(const SlotHandle &other) const = default;
+  };
+
+  /*
+  NOTE: Elements live densely packed in one VecT, so iteration is a linear scan; a slot
+        array indexed by handle maps each handle to its element's current position.
+        Insert, erase and lookup are O(1). Erase moves the last element into the hole,
+        so element pointers and iteration order are not stable - handles are.
+
+        A slot's generation is odd while it is occupied. It is bumped on every insert and
+        erase, and a slot whose generation would wrap is retired instead of reused, so a
+        stale handle can never alias a newer element.
+  */
+  template<typename T, typename AllocatorT = memory::HeapAllocator>
+    requires memory::AllocatorType<AllocatorT>
+  class SlotMap
+  {
+    struct Slot
+    {
+      // Position in m_values while occupied; next free slot while free.
+      u32 index;
+      u32 generation;
+    };
+
+    static constexpr u32 MAX_GENERATION = UINT32_MAX;
+
+    VecT<T, usize, AllocatorT> m_values;
+    VecT<u32, usize, AllocatorT> m_value_slots;
+    VecT<Slot, usize, AllocatorT> m_slots;
+    u32 m_free_head = SlotHandle::INVALID_INDEX;
+
+public:
+    using value_type = T;
+    using size_type = usize;
+    using iterator = T *;
+    using const_iterator = const T *;
+
+    SlotMap() = default;
+
+    explicit SlotMap(AllocatorT allocator) : m_values(allocator), m_value_slots(allocator), m_slots(allocator)
+    {
+    }
+
+    [[nodiscard]] const AllocatorT &get_allocator() const
+    {
+      return m_values.get_allocator();
+    }
+
+public:
+    template<typename... Args> SlotHandle emplace(Args &&...args)
+    {
+      if (m_values.size() >= static_cast<usize>(SlotHandle::INVALID_INDEX))
+        panic("SlotMap is full");
+
+      u32 slot_idx = m_free_head;
+      if (slot_idx != SlotHandle::INVALID_INDEX)
+      {
+        m_free_head = m_slots[slot_idx].index;
+      }
+      else
+      {
+        slot_idx = static_cast<u32>(m_slots.size());
+        m_slots.push(Slot{0, 0});
+      }
+
+      Slot &slot = m_slots[slot_idx];
+      slot.index = static_cast<u32>(m_values.size());
+      slot.generation++;
+
+      m_values.emplace_back(std::forward<Args>(args)...);
+      m_value_slots.push(slot_idx);
+      return SlotHandle{slot_idx, slot.generation};
+    }
+
+    SlotHandle insert(const T &value)
+    {
+      return emplace(value);
+    }
+
+    SlotHandle insert(T &&value)
+    {
+      return emplace(std::move(value));
+    }
+
+    // Returns false if `handle` was already stale.
+    bool erase(SlotHandle handle)
+    {
+      if (!contains(handle))
+        return false;
+
+      Slot &slot = m_slots[handle.index];
+      const u32 hole = slot.index;
+      const u32 last = static_cast<u32>(m_values.size() - 1);
+      if (hole != last)
+      {
+        m_values[hole] = std::move(m_values[last]);
+        m_value_slots[hole] = m_value_slots[last];
+        m_slots[m_value_slots[hole]].index = hole;
+      }
+      m_values.pop();
+      m_value_slots.pop();
+
+      release_slot(handle.index);
+      return true;
+    }
+
+    void clear()
+    {
+      for (const u32 slot_idx : m_value_slots)
+        release_slot(slot_idx);
+      m_values.clear();
+      m_value_slots.clear();
+    }
+
+    void reserve(size_type new_cap)
+    {
+      m_values.reserve(new_cap);
+      m_value_slots.reserve(new_cap);
+      m_slots.reserve(new_cap);
+    }
+
+public:
+    [[nodiscard]] bool contains(SlotHandle handle) const
+    {
+      return handle.index < m_slots.size() && m_slots[handle.index].generation == handle.generation &&
+             (handle.generation & 1);
+    }
+
+    // nullptr for stale handles. The pointer is invalidated by any insert or erase.
+    [[nodiscard]] T *get(SlotHandle handle)
+    {
+      return contains(handle) ? &m_values[m_slots[handle.index].index] : nullptr;
+    }
+
+    [[nodiscard]] const T *get(SlotHandle handle) const
+    {
+      return contains(handle) ? &m_values[m_slots[handle.index].index] : nullptr;
+    }
+
+    // Handle of the element at dense position `idx` in [0, size()), e.g. while iterating.
+    [[nodiscard]] SlotHandle handle_at(usize idx) const
+    {
+      const u32 slot_idx = m_value_slots[idx];
+      return SlotHandle{slot_idx, m_slots[slot_idx].generation};
+    }
+
+    [[nodiscard]] size_type size() const
+    {
+      return m_values.size();
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+      return m_values.empty();
+    }
+
+    [[nodiscard]] Span<T> values()
+    {
+      return m_values.as_span();
+    }
+
+    [[nodiscard]] Span<const T> values() const
+    {
+      return m_values.as_span();
+    }
+
+    iterator begin()
+    {
+      return m_values.begin();
+    }
+
+    iterator end()
+    {
+      return m_values.end();
+    }
+
+    const_iterator begin() const
+    {
+      return m_values.begin();
+    }
+
+    const_iterator end() const
+    {
+      return m_values.end();
+    }
+
+private:
+    void release_slot(u32 slot_idx)
+    {
+      Slot &slot = m_slots[slot_idx];
+      // The next generation would wrap to one already handed out: retire the slot. An even
+      // generation matches no handle, and the slot never re-enters the free list.
+      if (slot.generation == MAX_GENERATION)
+      {
+        slot.generation = 0;
+        return;
+      }
+      slot.generation++;
+      slot.index = m_free_head;
+      m_free_head = slot_idx;
+    }
+  };
+} // namespace au::containers
+
+namespace au
+{
+  using containers::SlotHandle;
+
+  template<typename T> using SlotMap = containers::SlotMap<T>;
+} // namespace au
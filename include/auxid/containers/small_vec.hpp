@@ -0,0 +1,498 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <auxid/containers/vec.hpp>
+
+#include <limits>
+
+namespace au::containers
+{
+  /*
+  NOTE: VecT with room for N elements inside the object itself. Nothing is allocated
+        until the size exceeds N; from then on it behaves exactly like VecT on
+        AllocatorT and never returns to the inline buffer. Elements are always
+        contiguous, so iterators are plain pointers and it converts to Span like VecT.
+
+        Moving an inline SmallVecT moves its elements one by one (it cannot steal a
+        buffer it does not own), so keep N small for types that are expensive to move.
+  */
+  template<typename T, usize N, typename size_type = usize, typename AllocatorT = memory::HeapAllocator>
+    requires memory::AllocatorType<AllocatorT>
+  class SmallVecT
+  {
+    static_assert(N > 0, "SmallVecT needs at least one inline element; use VecT otherwise");
+    static_assert(N <= static_cast<usize>(std::numeric_limits<size_type>::max()),
+                  "SmallVecT inline capacity does not fit size_type");
+
+    T *m_data;
+    size_type m_size = 0;
+    size_type m_capacity = static_cast<size_type>(N);
+    AUXID_NO_UNIQUE_ADDRESS AllocatorT m_allocator;
+    alignas(T) u8 m_inline[N * sizeof(T)];
+
+public:
+    using value_type = T;
+    using difference_type = isize;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using iterator = T *;
+    using const_iterator = const T *;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr usize INLINE_CAPACITY = N;
+
+    explicit SmallVecT() : m_data(inline_data())
+    {
+    }
+
+    explicit SmallVecT(AllocatorT allocator) : m_data(inline_data()), m_allocator(std::move(allocator))
+    {
+    }
+
+    explicit SmallVecT(size_type init_size, const T &init_value = T{}) : m_data(inline_data())
+    {
+      resize(init_size, init_value);
+    }
+
+    SmallVecT(std::initializer_list<T> init) : m_data(inline_data())
+    {
+      reserve(static_cast<size_type>(init.size()));
+      copy_from(init.begin(), static_cast<size_type>(init.size()));
+    }
+
+    SmallVecT(SmallVecT &&other) noexcept : m_data(inline_data()), m_allocator(std::move(other.m_allocator))
+    {
+      take(other);
+    }
+
+    SmallVecT &operator=(SmallVecT &&other) noexcept
+    {
+      if (this != &other)
+      {
+        clear();
+        release();
+        m_allocator = std::move(other.m_allocator);
+        take(other);
+      }
+      return *this;
+    }
+
+    SmallVecT(const SmallVecT &other) : m_data(inline_data()), m_allocator(other.m_allocator)
+    {
+      reserve(other.m_size);
+      copy_from(other.m_data, other.m_size);
+    }
+
+    SmallVecT &operator=(const SmallVecT &other)
+    {
+      if (this != &other)
+      {
+        clear();
+        reserve(other.m_size);
+        copy_from(other.m_data, other.m_size);
+      }
+      return *this;
+    }
+
+    ~SmallVecT()
+    {
+      clear();
+      release();
+    }
+
+public:
+    [[nodiscard]] SmallVecT clone() const
+    {
+      return SmallVecT(*this);
+    }
+
+    template<typename... Args> T &emplace_back(Args &&...args)
+    {
+      if (m_size >= m_capacity)
+      {
+        grow();
+      }
+      au::construct_at(&m_data[m_size], std::forward<Args>(args)...);
+      return m_data[m_size++];
+    }
+
+    void push(const T &val)
+    {
+      emplace_back(val);
+    }
+
+    void push(T &&val)
+    {
+      emplace_back(std::move(val));
+    }
+
+    void push_back(const T &val)
+    {
+      emplace_back(val);
+    }
+
+    void push_back(T &&val)
+    {
+      emplace_back(std::move(val));
+    }
+
+    void pop()
+    {
+      if (m_size > 0)
+      {
+        m_size--;
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+          au::destroy_at(&m_data[m_size]);
+        }
+      }
+    }
+
+    void pop_back()
+    {
+      pop();
+    }
+
+    void clear()
+    {
+      if constexpr (!std::is_trivially_destructible_v<T>)
+      {
+        for (size_type i = 0; i < m_size; ++i)
+        {
+          au::destroy_at(&m_data[i]);
+        }
+      }
+      m_size = 0;
+    }
+
+    void reserve(size_type new_cap)
+    {
+      if (new_cap <= m_capacity)
+        return;
+
+      if (!is_inline())
+      {
+        if (memory::try_expand_in_place(m_allocator, m_data, m_capacity * sizeof(T), new_cap * sizeof(T), alignof(T)))
+        {
+          m_capacity = new_cap;
+          return;
+        }
+
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+          void *ptr = m_allocator.realloc(m_data, m_capacity * sizeof(T), new_cap * sizeof(T), alignof(T));
+          if (ptr)
+          {
+            m_data = static_cast<T *>(ptr);
+            m_capacity = new_cap;
+            return;
+          }
+        }
+      }
+
+      T *new_data = static_cast<T *>(m_allocator.alloc(new_cap * sizeof(T), alignof(T)));
+      relocate(m_data, new_data, m_size);
+      release();
+
+      m_data = new_data;
+      m_capacity = new_cap;
+    }
+
+    void resize(size_type new_size)
+    {
+      if (new_size > m_size)
+      {
+        if (new_size > m_capacity)
+          reserve(new_size);
+        for (size_type i = m_size; i < new_size; ++i)
+        {
+          au::construct_at(&m_data[i]);
+        }
+      }
+      else if (new_size < m_size)
+      {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+          for (size_type i = new_size; i < m_size; ++i)
+          {
+            au::destroy_at(&m_data[i]);
+          }
+        }
+      }
+      m_size = new_size;
+    }
+
+    void resize(size_type new_size, const T &fill_val)
+    {
+      if (new_size > m_size)
+      {
+        if (new_size > m_capacity)
+          reserve(new_size);
+        for (size_type i = m_size; i < new_size; ++i)
+        {
+          au::construct_at(&m_data[i], fill_val);
+        }
+      }
+      else if (new_size < m_size)
+      {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+          for (size_type i = new_size; i < m_size; ++i)
+          {
+            au::destroy_at(&m_data[i]);
+          }
+        }
+      }
+      m_size = new_size;
+    }
+
+public:
+    // True while the elements live in the object itself rather than on AllocatorT.
+    [[nodiscard]] bool is_inline() const
+    {
+      return m_data == inline_data();
+    }
+
+    [[nodiscard]] size_type size() const
+    {
+      return m_size;
+    }
+
+    [[nodiscard]] const AllocatorT &get_allocator() const
+    {
+      return m_allocator;
+    }
+
+    [[nodiscard]] size_type capacity() const
+    {
+      return m_capacity;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+      return m_size == 0;
+    }
+
+    [[nodiscard]] T *data()
+    {
+      return m_data;
+    }
+
+    [[nodiscard]] const T *data() const
+    {
+      return m_data;
+    }
+
+    T &operator[](size_type idx)
+    {
+#if !defined(NDEBUG)
+      if (idx >= m_size)
+        panic("SmallVecT index out of bounds");
+#endif
+      return m_data[idx];
+    }
+
+    const T &operator[](size_type idx) const
+    {
+#if !defined(NDEBUG)
+      if (idx >= m_size)
+        panic("SmallVecT index out of bounds");
+#endif
+      return m_data[idx];
+    }
+
+    T *begin()
+    {
+      return m_data;
+    }
+
+    T *end()
+    {
+      return m_data + m_size;
+    }
+
+    const T *begin() const
+    {
+      return m_data;
+    }
+
+    const T *end() const
+    {
+      return m_data + m_size;
+    }
+
+    [[nodiscard]] const_iterator cbegin() const noexcept
+    {
+      return begin();
+    }
+
+    [[nodiscard]] const_iterator cend() const noexcept
+    {
+      return end();
+    }
+
+    [[nodiscard]] reverse_iterator rbegin() noexcept
+    {
+      return reverse_iterator(end());
+    }
+
+    [[nodiscard]] reverse_iterator rend() noexcept
+    {
+      return reverse_iterator(begin());
+    }
+
+    [[nodiscard]] const_reverse_iterator rbegin() const noexcept
+    {
+      return const_reverse_iterator(end());
+    }
+
+    [[nodiscard]] const_reverse_iterator rend() const noexcept
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    [[nodiscard]] const_reverse_iterator crbegin() const noexcept
+    {
+      return rbegin();
+    }
+
+    [[nodiscard]] const_reverse_iterator crend() const noexcept
+    {
+      return rend();
+    }
+
+    T &back()
+    {
+      return m_data[m_size - 1];
+    }
+
+    const T &back() const
+    {
+      return m_data[m_size - 1];
+    }
+
+    operator Span<T>()
+    {
+      return Span<T>(m_data, m_size);
+    }
+
+    operator Span<const T>() const
+    {
+      return Span<const T>(m_data, m_size);
+    }
+
+    [[nodiscard]] Span<T> as_span()
+    {
+      return Span<T>(m_data, m_size);
+    }
+
+    [[nodiscard]] Span<const T> as_span() const
+    {
+      return Span<const T>(m_data, m_size);
+    }
+
+private:
+    [[nodiscard]] T *inline_data()
+    {
+      return reinterpret_cast<T *>(m_inline);
+    }
+
+    [[nodiscard]] const T *inline_data() const
+    {
+      return reinterpret_cast<const T *>(m_inline);
+    }
+
+    void grow()
+    {
+      reserve(m_capacity + (m_capacity / 2) + 1);
+    }
+
+    // Frees the heap buffer, if any, and points back at the inline one. Elements must
+    // already be destroyed or relocated.
+    void release()
+    {
+      if (!is_inline())
+        m_allocator.free(m_data, m_capacity * sizeof(T), alignof(T));
+      m_data = inline_data();
+      m_capacity = static_cast<size_type>(N);
+    }
+
+    // Move-constructs `count` elements into uninitialized `dst` and destroys the sources.
+    static void relocate(T *src, T *dst, size_type count)
+    {
+      if constexpr (std::is_trivially_copyable_v<T>)
+      {
+        if (count > 0)
+          std::memcpy(dst, src, count * sizeof(T));
+      }
+      else
+      {
+        for (size_type i = 0; i < count; ++i)
+        {
+          au::construct_at(&dst[i], std::move(src[i]));
+          au::destroy_at(&src[i]);
+        }
+      }
+    }
+
+    // Appends copies of `count` elements; capacity must already suffice.
+    void copy_from(const T *src, size_type count)
+    {
+      if constexpr (std::is_trivially_copyable_v<T>)
+      {
+        if (count > 0)
+          std::memcpy(m_data + m_size, src, count * sizeof(T));
+      }
+      else
+      {
+        for (size_type i = 0; i < count; ++i)
+        {
+          au::construct_at(&m_data[m_size + i], src[i]);
+        }
+      }
+      m_size += count;
+    }
+
+    // Steals `other`'s heap buffer, or relocates its inline elements; `other` ends empty
+    // and inline. This object must be empty and inline.
+    void take(SmallVecT &other)
+    {
+      if (other.is_inline())
+      {
+        relocate(other.m_data, m_data, other.m_size);
+      }
+      else
+      {
+        m_data = other.m_data;
+        m_capacity = other.m_capacity;
+        other.m_data = other.inline_data();
+        other.m_capacity = static_cast<size_type>(N);
+      }
+      m_size = other.m_size;
+      other.m_size = 0;
+    }
+  };
+} // namespace au::containers
+
+namespace au
+{
+  template<typename T, usize N> using SmallVec = containers::SmallVecT<T, N, usize>;
+} // namespace au
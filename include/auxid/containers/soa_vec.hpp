@@ -0,0 +1,500 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <auxid/containers/span.hpp>
+#include <auxid/memory/heap.hpp>
+#include <auxid/pch.hpp>
+
+#include <cstring>
+#include <tuple>
+
+namespace au::containers
+{
+  // Iterator over rows of parallel columns; dereferences to a tuple of references, so it
+  // works with structured bindings: `for (auto [pos, vel] : soa.zip<0, 1>())`.
+  template<typename... Ts> class SoaZipIterator
+  {
+    std::tuple<Ts *...> m_columns;
+    usize m_index;
+
+public:
+    using value_type = std::tuple<Ts &...>;
+    using reference = std::tuple<Ts &...>;
+    using difference_type = isize;
+
+    SoaZipIterator(std::tuple<Ts *...> columns, usize index) : m_columns(columns), m_index(index)
+    {
+    }
+
+    reference operator*() const
+    {
+      return std::apply([this](Ts *...column) { return reference(column[m_index]...); }, m_columns);
+    }
+
+    SoaZipIterator &operator++()
+    {
+      ++m_index;
+      return *this;
+    }
+
+    SoaZipIterator operator++(int)
+    {
+      SoaZipIterator prev = *this;
+      ++m_index;
+      return prev;
+    }
+
+    bool operator==(const SoaZipIterator &other) const
+    {
+      return m_index == other.m_index;
+    }
+  };
+
+  template<typename... Ts> class SoaZipRange
+  {
+    std::tuple<Ts *...> m_columns;
+    usize m_size;
+
+public:
+    SoaZipRange(std::tuple<Ts *...> columns, usize size) : m_columns(columns), m_size(size)
+    {
+    }
+
+    [[nodiscard]] SoaZipIterator<Ts...> begin() const
+    {
+      return SoaZipIterator<Ts...>(m_columns, 0);
+    }
+
+    [[nodiscard]] SoaZipIterator<Ts...> end() const
+    {
+      return SoaZipIterator<Ts...>(m_columns, m_size);
+    }
+
+    [[nodiscard]] usize size() const
+    {
+      return m_size;
+    }
+  };
+
+  /*
+  NOTE: Structure-of-arrays vector: each field lives in its own contiguous column, so a
+        loop over two fields streams only those two columns instead of whole structs.
+        All columns share one allocation; each starts on its own cache line, which keeps
+        them SIMD-friendly and stops neighbouring columns from sharing a line.
+
+        Growth reallocates the whole block, since every column's offset depends on the
+        capacity. Removal is swap_remove (O(1), does not preserve order).
+  */
+  template<typename AllocatorT, typename... Fields>
+    requires memory::AllocatorType<AllocatorT>
+  class SoaVecT
+  {
+    static_assert(sizeof...(Fields) > 0, "SoaVec needs at least one field");
+
+public:
+    static constexpr usize FIELD_COUNT = sizeof...(Fields);
+    static constexpr usize COLUMN_ALIGN = 64;
+
+    template<usize I> using field_type = std::tuple_element_t<I, std::tuple<Fields...>>;
+
+    using reference = std::tuple<Fields &...>;
+    using const_reference = std::tuple<const Fields &...>;
+    using iterator = SoaZipIterator<Fields...>;
+    using const_iterator = SoaZipIterator<const Fields...>;
+
+private:
+    template<typename T> static constexpr usize column_align()
+    {
+      return alignof(T) > COLUMN_ALIGN ? alignof(T) : COLUMN_ALIGN;
+    }
+
+    static constexpr usize BLOCK_ALIGN = [] {
+      usize align = COLUMN_ALIGN;
+      ((align = column_align<Fields>() > align ? column_align<Fields>() : align), ...);
+      return align;
+    }();
+
+    u8 *m_block = nullptr;
+    usize m_size = 0;
+    usize m_capacity = 0;
+    std::tuple<Fields *...> m_columns{};
+    AUXID_NO_UNIQUE_ADDRESS AllocatorT m_allocator;
+
+public:
+    SoaVecT() = default;
+
+    explicit SoaVecT(AllocatorT allocator) : m_allocator(std::move(allocator))
+    {
+    }
+
+    SoaVecT(SoaVecT &&other) noexcept
+        : m_block(other.m_block), m_size(other.m_size), m_capacity(other.m_capacity), m_columns(other.m_columns),
+          m_allocator(std::move(other.m_allocator))
+    {
+      other.m_block = nullptr;
+      other.m_size = 0;
+      other.m_capacity = 0;
+      other.m_columns = {};
+    }
+
+    SoaVecT &operator=(SoaVecT &&other) noexcept
+    {
+      if (this != &other)
+      {
+        clear();
+        release();
+
+        m_allocator = std::move(other.m_allocator);
+        m_block = other.m_block;
+        m_size = other.m_size;
+        m_capacity = other.m_capacity;
+        m_columns = other.m_columns;
+
+        other.m_block = nullptr;
+        other.m_size = 0;
+        other.m_capacity = 0;
+        other.m_columns = {};
+      }
+      return *this;
+    }
+
+    SoaVecT(const SoaVecT &other) : m_allocator(other.m_allocator)
+    {
+      copy_from(other);
+    }
+
+    SoaVecT &operator=(const SoaVecT &other)
+    {
+      if (this != &other)
+      {
+        clear();
+        copy_from(other);
+      }
+      return *this;
+    }
+
+    ~SoaVecT()
+    {
+      clear();
+      release();
+    }
+
+public:
+    [[nodiscard]] SoaVecT clone() const
+    {
+      return SoaVecT(*this);
+    }
+
+    // Appends one row; takes exactly one value per field, in field order.
+    template<typename... Args>
+      requires(sizeof...(Args) == FIELD_COUNT)
+    void push(Args &&...values)
+    {
+      if (m_size >= m_capacity)
+        grow();
+      construct_row(m_size, std::index_sequence_for<Fields...>{}, std::forward<Args>(values)...);
+      m_size++;
+    }
+
+    void pop()
+    {
+      if (m_size > 0)
+      {
+        m_size--;
+        destroy_rows(m_size, m_size + 1);
+      }
+    }
+
+    // Moves the last row into `idx` and drops the last row.
+    void swap_remove(usize idx)
+    {
+#if !defined(NDEBUG)
+      if (idx >= m_size)
+        panic("SoaVec index out of bounds");
+#endif
+      const usize last = m_size - 1;
+      if (idx != last)
+      {
+        for_each_column([&](auto *column) { column[idx] = std::move(column[last]); });
+      }
+      pop();
+    }
+
+    void clear()
+    {
+      destroy_rows(0, m_size);
+      m_size = 0;
+    }
+
+    void reserve(usize new_cap)
+    {
+      if (new_cap <= m_capacity)
+        return;
+
+      u8 *new_block = static_cast<u8 *>(m_allocator.alloc(block_size(new_cap), BLOCK_ALIGN));
+      std::tuple<Fields *...> new_columns = columns_for(new_block, new_cap);
+
+      relocate_columns(new_columns, std::index_sequence_for<Fields...>{});
+      release();
+
+      m_block = new_block;
+      m_columns = new_columns;
+      m_capacity = new_cap;
+    }
+
+    // Default-constructs every field of the new rows.
+    void resize(usize new_size)
+    {
+      if (new_size > m_size)
+      {
+        reserve(new_size);
+        for_each_column([&](auto *column) {
+          for (usize i = m_size; i < new_size; ++i)
+            au::construct_at(&column[i]);
+        });
+      }
+      else
+      {
+        destroy_rows(new_size, m_size);
+      }
+      m_size = new_size;
+    }
+
+public:
+    [[nodiscard]] usize size() const
+    {
+      return m_size;
+    }
+
+    [[nodiscard]] usize capacity() const
+    {
+      return m_capacity;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+      return m_size == 0;
+    }
+
+    [[nodiscard]] const AllocatorT &get_allocator() const
+    {
+      return m_allocator;
+    }
+
+    template<usize I> [[nodiscard]] Span<field_type<I>> column()
+    {
+      return Span<field_type<I>>(std::get<I>(m_columns), m_size);
+    }
+
+    template<usize I> [[nodiscard]] Span<const field_type<I>> column() const
+    {
+      return Span<const field_type<I>>(std::get<I>(m_columns), m_size);
+    }
+
+    template<usize I> [[nodiscard]] field_type<I> &get(usize idx)
+    {
+#if !defined(NDEBUG)
+      if (idx >= m_size)
+        panic("SoaVec index out of bounds");
+#endif
+      return std::get<I>(m_columns)[idx];
+    }
+
+    template<usize I> [[nodiscard]] const field_type<I> &get(usize idx) const
+    {
+#if !defined(NDEBUG)
+      if (idx >= m_size)
+        panic("SoaVec index out of bounds");
+#endif
+      return std::get<I>(m_columns)[idx];
+    }
+
+    reference operator[](usize idx)
+    {
+#if !defined(NDEBUG)
+      if (idx >= m_size)
+        panic("SoaVec index out of bounds");
+#endif
+      return *iterator(m_columns, idx);
+    }
+
+    const_reference operator[](usize idx) const
+    {
+#if !defined(NDEBUG)
+      if (idx >= m_size)
+        panic("SoaVec index out of bounds");
+#endif
+      return *const_iterator(const_columns(), idx);
+    }
+
+    // Rows over the selected columns only, e.g. `zip<0, 2>()`.
+    template<usize... I> [[nodiscard]] SoaZipRange<field_type<I>...> zip()
+    {
+      return SoaZipRange<field_type<I>...>(std::tuple<field_type<I> *...>(std::get<I>(m_columns)...), m_size);
+    }
+
+    template<usize... I> [[nodiscard]] SoaZipRange<const field_type<I>...> zip() const
+    {
+      return SoaZipRange<const field_type<I>...>(std::tuple<const field_type<I> *...>(std::get<I>(m_columns)...),
+                                                 m_size);
+    }
+
+    iterator begin()
+    {
+      return iterator(m_columns, 0);
+    }
+
+    iterator end()
+    {
+      return iterator(m_columns, m_size);
+    }
+
+    const_iterator begin() const
+    {
+      return const_iterator(const_columns(), 0);
+    }
+
+    const_iterator end() const
+    {
+      return const_iterator(const_columns(), m_size);
+    }
+
+private:
+    static constexpr usize align_up(usize v, usize align)
+    {
+      return (v + align - 1) & ~(align - 1);
+    }
+
+    static usize block_size(usize cap)
+    {
+      usize offset = 0;
+      ((offset = align_up(offset, column_align<Fields>()) + cap * sizeof(Fields)), ...);
+      return offset;
+    }
+
+    static std::tuple<Fields *...> columns_for(u8 *block, usize cap)
+    {
+      usize offset = 0;
+      const auto place = [&]<typename T>(T *) {
+        offset = align_up(offset, column_align<T>());
+        T *column = reinterpret_cast<T *>(block + offset);
+        offset += cap * sizeof(T);
+        return column;
+      };
+      // Braced init evaluates left to right, so columns are laid out in field order.
+      return std::tuple<Fields *...>{place(static_cast<Fields *>(nullptr))...};
+    }
+
+    std::tuple<const Fields *...> const_columns() const
+    {
+      return std::apply([](Fields *...column) { return std::tuple<const Fields *...>(column...); }, m_columns);
+    }
+
+    template<typename F> void for_each_column(F &&fn)
+    {
+      std::apply([&](Fields *...column) { (fn(column), ...); }, m_columns);
+    }
+
+    void grow()
+    {
+      reserve(m_capacity == 0 ? 8 : m_capacity + (m_capacity / 2) + 1);
+    }
+
+    void release()
+    {
+      if (m_block)
+        m_allocator.free(m_block, block_size(m_capacity), BLOCK_ALIGN);
+      m_block = nullptr;
+      m_capacity = 0;
+      m_columns = {};
+    }
+
+    template<usize... I, typename... Args> void construct_row(usize idx, std::index_sequence<I...>, Args &&...values)
+    {
+      (au::construct_at(&std::get<I>(m_columns)[idx], std::forward<Args>(values)), ...);
+    }
+
+    void destroy_rows(usize from, usize to)
+    {
+      for_each_column([&]<typename T>(T *column) {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+          for (usize i = from; i < to; ++i)
+            au::destroy_at(&column[i]);
+        }
+      });
+    }
+
+    template<usize... I> void relocate_columns(const std::tuple<Fields *...> &dst, std::index_sequence<I...>)
+    {
+      (relocate(std::get<I>(m_columns), std::get<I>(dst), m_size), ...);
+    }
+
+    template<typename T> static void relocate(T *src, T *dst, usize count)
+    {
+      if (count == 0)
+        return;
+      if constexpr (std::is_trivially_copyable_v<T>)
+      {
+        std::memcpy(dst, src, count * sizeof(T));
+      }
+      else
+      {
+        for (usize i = 0; i < count; ++i)
+        {
+          au::construct_at(&dst[i], std::move(src[i]));
+          au::destroy_at(&src[i]);
+        }
+      }
+    }
+
+    void copy_from(const SoaVecT &other)
+    {
+      reserve(other.m_size);
+      copy_columns(other, std::index_sequence_for<Fields...>{});
+      m_size = other.m_size;
+    }
+
+    template<usize... I> void copy_columns(const SoaVecT &other, std::index_sequence<I...>)
+    {
+      (copy_column(std::get<I>(other.m_columns), std::get<I>(m_columns), other.m_size), ...);
+    }
+
+    template<typename T> static void copy_column(const T *src, T *dst, usize count)
+    {
+      if (count == 0)
+        return;
+      if constexpr (std::is_trivially_copyable_v<T>)
+      {
+        std::memcpy(dst, src, count * sizeof(T));
+      }
+      else
+      {
+        for (usize i = 0; i < count; ++i)
+          au::construct_at(&dst[i], src[i]);
+      }
+    }
+  };
+
+  template<typename... Fields> using SoaVec = SoaVecT<memory::HeapAllocator, Fields...>;
+} // namespace au::containers
+
+namespace au
+{
+  template<typename... Fields> using SoaVec = containers::SoaVec<Fields...>;
+} // namespace au
@@ -15,73 +15,375 @@
 
 #pragma once
 
-#include <auxid/pch.hpp>
+#include <auxid/containers/option.hpp>
+#include <auxid/containers/span.hpp>
+#include <auxid/memory/heap.hpp>
+#include <auxid/result.hpp>
 
 #include <atomic>
 #include <utility>
 
 namespace au::containers
 {
+  namespace spsc
+  {
+    inline constexpr usize CACHE_LINE = 64;
+
+    // Single-producer/single-consumer indices over a power-of-two array of slots. The
+    // slots are passed in, so the fixed and the heap-backed queue share it. Each side
+    // keeps a private copy of the other side's index and only reloads the shared one when
+    // that copy says the ring is full (producer) or empty (consumer), so in steady state
+    // neither core touches the other's cache line.
+    template<typename T> class Ring
+    {
+      // Written by the producer only; the cached read index never leaves its cache line.
+      struct alignas(CACHE_LINE) ProducerState
+      {
+        std::atomic<usize> write_pos{0};
+        usize cached_read_pos = 0;
+      };
+
+      // Written by the consumer only.
+      struct alignas(CACHE_LINE) ConsumerState
+      {
+        std::atomic<usize> read_pos{0};
+        usize cached_write_pos = 0;
+      };
+
+      ProducerState m_producer;
+      ConsumerState m_consumer;
+
+  public:
+      template<typename U> bool push(T *slots, usize mask, U &&value)
+      {
+        const usize write_idx = m_producer.write_pos.load(std::memory_order_relaxed);
+
+        if (write_idx - m_producer.cached_read_pos > mask)
+        {
+          m_producer.cached_read_pos = m_consumer.read_pos.load(std::memory_order_acquire);
+          if (write_idx - m_producer.cached_read_pos > mask)
+            return false;
+        }
+
+        new (&slots[write_idx & mask]) T(std::forward<U>(value));
+
+        m_producer.write_pos.store(write_idx + 1, std::memory_order_release);
+        return true;
+      }
+
+      // Moves the front element straight into the returned Option.
+      Option<T> pop(T *slots, usize mask)
+      {
+        const usize read_idx = m_consumer.read_pos.load(std::memory_order_relaxed);
+        if (!readable(read_idx, 1))
+          return nullopt;
+
+        T *value = &slots[read_idx & mask];
+        Option<T> result(std::move(*value));
+        value->~T();
+
+        m_consumer.read_pos.store(read_idx + 1, std::memory_order_release);
+        return result;
+      }
+
+      bool pop(T *slots, usize mask, T &out_value)
+      {
+        const usize read_idx = m_consumer.read_pos.load(std::memory_order_relaxed);
+        if (!readable(read_idx, 1))
+          return false;
+
+        T *value = &slots[read_idx & mask];
+        out_value = std::move(*value);
+        value->~T();
+
+        m_consumer.read_pos.store(read_idx + 1, std::memory_order_release);
+        return true;
+      }
+
+      usize push_bulk(T *slots, usize mask, T *values, usize count)
+      {
+        const usize write_idx = m_producer.write_pos.load(std::memory_order_relaxed);
+
+        usize free = mask + 1 - (write_idx - m_producer.cached_read_pos);
+        if (free < count)
+        {
+          m_producer.cached_read_pos = m_consumer.read_pos.load(std::memory_order_acquire);
+          free = mask + 1 - (write_idx - m_producer.cached_read_pos);
+        }
+
+        const usize n = count < free ? count : free;
+        for (usize i = 0; i < n; ++i)
+          new (&slots[(write_idx + i) & mask]) T(std::move(values[i]));
+
+        if (n > 0)
+          m_producer.write_pos.store(write_idx + n, std::memory_order_release);
+        return n;
+      }
+
+      usize pop_bulk(T *slots, usize mask, T *out_values, usize count)
+      {
+        const usize read_idx = m_consumer.read_pos.load(std::memory_order_relaxed);
+        readable(read_idx, count);
+
+        const usize available = m_consumer.cached_write_pos - read_idx;
+        const usize n = count < available ? count : available;
+        for (usize i = 0; i < n; ++i)
+        {
+          T *value = &slots[(read_idx + i) & mask];
+          out_values[i] = std::move(*value);
+          value->~T();
+        }
+
+        if (n > 0)
+          m_consumer.read_pos.store(read_idx + n, std::memory_order_release);
+        return n;
+      }
+
+      [[nodiscard]] usize size_approx() const
+      {
+        const usize write_pos = m_producer.write_pos.load(std::memory_order_relaxed);
+        const usize read_pos = m_consumer.read_pos.load(std::memory_order_relaxed);
+        return write_pos - read_pos;
+      }
+
+      // Destroys whatever is still queued in place. Only valid once both sides are done.
+      void drain(T *slots, usize mask)
+      {
+        const usize write_pos = m_producer.write_pos.load(std::memory_order_acquire);
+        usize read_pos = m_consumer.read_pos.load(std::memory_order_relaxed);
+        for (; read_pos != write_pos; ++read_pos)
+          slots[read_pos & mask].~T();
+        m_consumer.read_pos.store(read_pos, std::memory_order_relaxed);
+        m_consumer.cached_write_pos = read_pos;
+      }
+
+  private:
+      // True if at least `count` elements are visible from `read_idx`, refreshing the
+      // cached write index when the cached one does not show enough.
+      bool readable(usize read_idx, usize count)
+      {
+        if (m_consumer.cached_write_pos - read_idx >= count)
+          return true;
+        m_consumer.cached_write_pos = m_producer.write_pos.load(std::memory_order_acquire);
+        return m_consumer.cached_write_pos - read_idx >= count;
+      }
+    };
+  } // namespace spsc
+
+  /*
+  NOTE: Bounded single-producer/single-consumer queue with inline storage. The bulk calls
+        move many elements and publish them with a single release store. For capacities
+        chosen at runtime, or too large for the stack, use DynamicSpscQueue.
+  */
   template<typename T, usize Capacity>
     requires((Capacity != 0) && ((Capacity & (Capacity - 1)) == 0))
   class SpscQueue
   {
+    static constexpr usize K_MASK = Capacity - 1;
+
+    spsc::Ring<T> m_ring;
+    alignas(T) u8 m_slots[Capacity * sizeof(T)];
+
 public:
     SpscQueue() = default;
 
     ~SpscQueue()
     {
-      T dummy;
-      while (pop(dummy))
-      {
-      }
+      m_ring.drain(slots(), K_MASK);
     }
 
     SpscQueue(const SpscQueue &) = delete;
     SpscQueue &operator=(const SpscQueue &) = delete;
 
-    [[nodiscard]] bool push(T value)
+public:
+    [[nodiscard]] bool push(const T &value)
     {
-      const usize write_idx = m_write_pos.load(std::memory_order_relaxed);
+      return m_ring.push(slots(), K_MASK, value);
+    }
 
-      const usize read_idx = m_read_pos.load(std::memory_order_acquire);
+    [[nodiscard]] bool push(T &&value)
+    {
+      return m_ring.push(slots(), K_MASK, std::move(value));
+    }
 
-      if (write_idx - read_idx == Capacity)
-        return false;
+    [[nodiscard]] Option<T> pop()
+    {
+      return m_ring.pop(slots(), K_MASK);
+    }
 
-      T *slot = reinterpret_cast<T *>(&m_slots[(write_idx & K_MASK) * sizeof(T)]);
+    [[nodiscard]] bool pop(T &out_value)
+    {
+      return m_ring.pop(slots(), K_MASK, out_value);
+    }
 
-      new (slot) T(std::move(value));
+    // Moves a prefix of `values` in; returns how many were taken (0 when full).
+    [[nodiscard]] usize push_bulk(Span<T> values)
+    {
+      return m_ring.push_bulk(slots(), K_MASK, values.data(), values.size());
+    }
 
-      m_write_pos.store(write_idx + 1, std::memory_order_release);
-      return true;
+    // Pops into a prefix of `out_values`; returns how many were written (0 when empty).
+    [[nodiscard]] usize pop_bulk(Span<T> out_values)
+    {
+      return m_ring.pop_bulk(slots(), K_MASK, out_values.data(), out_values.size());
     }
 
-    [[nodiscard]] bool pop(T &out_value)
+    [[nodiscard]] usize size_approx() const
     {
-      const usize read_idx = m_read_pos.load(std::memory_order_relaxed);
+      return m_ring.size_approx();
+    }
 
-      const usize write_idx = m_write_pos.load(std::memory_order_acquire);
+    [[nodiscard]] static constexpr usize capacity()
+    {
+      return Capacity;
+    }
+
+private:
+    T *slots()
+    {
+      return reinterpret_cast<T *>(m_slots);
+    }
+  };
+
+  /*
+  NOTE: SpscQueue with its capacity chosen at runtime (rounded up to a power of two). The
+        indices and slots live in one block from AllocatorT, so the queue itself is a
+        movable handle; moving it while the producer or consumer is running is not
+        allowed. Pass a memory::LargePageAllocator to put big queues on huge pages.
+  */
+  template<typename T, typename AllocatorT = memory::HeapAllocator>
+    requires memory::AllocatorType<AllocatorT>
+  class DynamicSpscQueue
+  {
+    // The indices sit in front of the slots, padded so the slots start on a cache line.
+    static constexpr usize BLOCK_ALIGN = alignof(T) > spsc::CACHE_LINE ? alignof(T) : spsc::CACHE_LINE;
+    static constexpr usize HEADER_SIZE = (sizeof(spsc::Ring<T>) + BLOCK_ALIGN - 1) & ~(BLOCK_ALIGN - 1);
+
+    u8 *m_block = nullptr;
+    usize m_mask = 0;
+    AUXID_NO_UNIQUE_ADDRESS AllocatorT m_allocator;
+
+public:
+    DynamicSpscQueue(const DynamicSpscQueue &) = delete;
+    DynamicSpscQueue &operator=(const DynamicSpscQueue &) = delete;
+
+    DynamicSpscQueue(DynamicSpscQueue &&other) noexcept
+        : m_block(other.m_block), m_mask(other.m_mask), m_allocator(std::move(other.m_allocator))
+    {
+      other.m_block = nullptr;
+    }
+
+    DynamicSpscQueue &operator=(DynamicSpscQueue &&other) noexcept
+    {
+      if (this != &other)
+      {
+        release();
+        m_block = other.m_block;
+        m_mask = other.m_mask;
+        m_allocator = std::move(other.m_allocator);
+        other.m_block = nullptr;
+      }
+      return *this;
+    }
+
+    ~DynamicSpscQueue()
+    {
+      release();
+    }
+
+    static auto create(usize requested_capacity, AllocatorT allocator = AllocatorT()) -> Result<DynamicSpscQueue>
+    {
+      if (requested_capacity == 0 || requested_capacity > (usize(1) << 40))
+        return fail("DynamicSpscQueue: invalid capacity %zu", requested_capacity);
+
+      usize capacity = 1;
+      while (capacity < requested_capacity)
+        capacity *= 2;
+
+      u8 *block = static_cast<u8 *>(allocator.alloc(block_size(capacity), BLOCK_ALIGN));
+      if (!block)
+        return fail("DynamicSpscQueue: failed to allocate %zu slots", capacity);
+
+      new (block) spsc::Ring<T>();
+      return DynamicSpscQueue(block, capacity - 1, std::move(allocator));
+    }
+
+public:
+    [[nodiscard]] bool push(const T &value)
+    {
+      return ring().push(slots(), m_mask, value);
+    }
 
-      if (read_idx == write_idx)
-        return false;
+    [[nodiscard]] bool push(T &&value)
+    {
+      return ring().push(slots(), m_mask, std::move(value));
+    }
+
+    [[nodiscard]] Option<T> pop()
+    {
+      return ring().pop(slots(), m_mask);
+    }
+
+    [[nodiscard]] bool pop(T &out_value)
+    {
+      return ring().pop(slots(), m_mask, out_value);
+    }
 
-      T *slot = reinterpret_cast<T *>(&m_slots[(read_idx & K_MASK) * sizeof(T)]);
+    [[nodiscard]] usize push_bulk(Span<T> values)
+    {
+      return ring().push_bulk(slots(), m_mask, values.data(), values.size());
+    }
 
-      out_value = std::move(*slot);
+    [[nodiscard]] usize pop_bulk(Span<T> out_values)
+    {
+      return ring().pop_bulk(slots(), m_mask, out_values.data(), out_values.size());
+    }
 
-      slot->~T();
+    [[nodiscard]] usize size_approx() const
+    {
+      return reinterpret_cast<const spsc::Ring<T> *>(m_block)->size_approx();
+    }
 
-      m_read_pos.store(read_idx + 1, std::memory_order_release);
-      return true;
+    [[nodiscard]] usize capacity() const
+    {
+      return m_mask + 1;
     }
 
 private:
-    static constexpr usize K_MASK = Capacity - 1;
+    DynamicSpscQueue(u8 *block, usize mask, AllocatorT allocator)
+        : m_block(block), m_mask(mask), m_allocator(std::move(allocator))
+    {
+    }
 
-    alignas(64) std::atomic<usize> m_write_pos{0};
-    alignas(64) std::atomic<usize> m_read_pos{0};
+    static usize block_size(usize capacity)
+    {
+      return HEADER_SIZE + capacity * sizeof(T);
+    }
 
-    alignas(T) u8 m_slots[Capacity * sizeof(T)];
+    spsc::Ring<T> &ring()
+    {
+      return *reinterpret_cast<spsc::Ring<T> *>(m_block);
+    }
+
+    T *slots()
+    {
+      return reinterpret_cast<T *>(m_block + HEADER_SIZE);
+    }
+
+    void release()
+    {
+      if (!m_block)
+        return;
+      ring().drain(slots(), m_mask);
+      ring().~Ring();
+      m_allocator.free(m_block, block_size(m_mask + 1), BLOCK_ALIGN);
+      m_block = nullptr;
+    }
   };
-} // namespace au::containers
\ No newline at end of file
+} // namespace au::containers
+
+namespace au
+{
+  template<typename T, usize Capacity> using SpscQueue = containers::SpscQueue<T, Capacity>;
+  template<typename T> using DynamicSpscQueue = containers::DynamicSpscQueue<T>;
+} // namespace au
@@ -0,0 +1,322 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <auxid/containers/hash_base.hpp>
+#include <auxid/containers/vec.hpp>
+#include <auxid/result.hpp>
+
+namespace au::containers
+{
+  /*
+  NOTE: Immutable map over a fixed key set, addressed by a minimal perfect hash (PTHash
+        style). Keys are split into buckets of ~BUCKET_LOAD keys; each bucket stores a
+        small "pilot" that displaces its keys into distinct slots of a table that is only
+        slightly larger than n, and the few slots past n are remapped into the holes
+        below n. A lookup is one hash, one pilot read, one entry read and one key compare.
+
+        The map is built once at runtime: Hash<K> is seeded per process, so the layout
+        cannot be fixed at compile time.
+  */
+  template<typename K, typename V, typename Hasher = Hash<K>, typename KeyEq = EqualTo<K>,
+           typename AllocatorT = memory::HeapAllocator>
+    requires memory::AllocatorType<AllocatorT>
+  class StaticMap
+  {
+public:
+    using value_type = Pair<K, V>;
+    using size_type = usize;
+    using const_iterator = const value_type *;
+
+    static constexpr usize BUCKET_LOAD = 2;
+
+private:
+    // Pilot search is cut off here; the build then retries with a fresh seed.
+    static constexpr u32 MAX_PILOT = UINT16_MAX;
+    static constexpr u32 MAX_SEED_ATTEMPTS = 16;
+
+    VecT<value_type, usize, AllocatorT> m_entries;
+    VecT<u16, usize, AllocatorT> m_pilots;
+    // For positions p in [n, table_size): the slot below n that p was moved to.
+    VecT<u32, usize, AllocatorT> m_remap;
+
+    u64 m_seed = 0;
+    u64 m_table_size = 0;
+
+    Hasher m_hasher;
+    KeyEq m_eq;
+
+public:
+    StaticMap() = default;
+
+    // Fails on duplicate keys, or if two distinct keys share a full 64-bit hash.
+    [[nodiscard]] static auto build(Span<const value_type> items) -> Result<StaticMap>
+    {
+      StaticMap map;
+      if (items.size() > static_cast<usize>(INDEX_INVALID))
+        return fail("StaticMap: too many keys (%zu)", items.size());
+      if (items.empty())
+        return map;
+
+      VecT<u64, usize, AllocatorT> hashes;
+      hashes.reserve(items.size());
+      for (const auto &item : items)
+        hashes.push(map.m_hasher(item.first));
+
+      VecT<u32, usize, AllocatorT> slot_to_item;
+      u64 seed = internal::HASH_SECRET[3];
+      for (u32 attempt = 0; attempt < MAX_SEED_ATTEMPTS; ++attempt)
+      {
+        AU_TRY_VAR(ok, map.try_build(items, hashes, seed, slot_to_item));
+        if (ok)
+        {
+          map.m_entries.reserve(items.size());
+          for (const u32 item_idx : slot_to_item)
+            map.m_entries.push(items[item_idx]);
+          return map;
+        }
+        seed = internal::mix(seed, internal::HASH_SECRET[attempt & 3]);
+      }
+      return fail("StaticMap: no perfect hash found for %zu keys", items.size());
+    }
+
+public:
+    [[nodiscard]] const V *find(const K &key) const
+    {
+      return find_impl(key);
+    }
+
+    template<typename Q>
+      requires TransparentLookup<Hasher, KeyEq>
+    [[nodiscard]] const V *find(const Q &key) const
+    {
+      return find_impl(key);
+    }
+
+    [[nodiscard]] bool contains(const K &key) const
+    {
+      return find_impl(key) != nullptr;
+    }
+
+    template<typename Q>
+      requires TransparentLookup<Hasher, KeyEq>
+    [[nodiscard]] bool contains(const Q &key) const
+    {
+      return find_impl(key) != nullptr;
+    }
+
+    [[nodiscard]] size_type size() const
+    {
+      return m_entries.size();
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+      return m_entries.empty();
+    }
+
+    [[nodiscard]] const_iterator begin() const
+    {
+      return m_entries.begin();
+    }
+
+    [[nodiscard]] const_iterator end() const
+    {
+      return m_entries.end();
+    }
+
+private:
+    [[nodiscard]] static usize bucket_count_for(usize n)
+    {
+      return n / BUCKET_LOAD + 1;
+    }
+
+    // Multiply-shift reduction of the top 32 bits of `x` onto [0, range).
+    [[nodiscard]] static u64 reduce(u64 x, u64 range)
+    {
+      return ((x >> 32) * range) >> 32;
+    }
+
+    [[nodiscard]] usize bucket_of(u64 h) const
+    {
+      return static_cast<usize>(reduce(internal::mix(h ^ m_seed, internal::HASH_SECRET[0]), m_pilots.size()));
+    }
+
+    [[nodiscard]] static u64 position(u64 h, u64 seed, u32 pilot, u64 table_size)
+    {
+      return reduce(internal::mix(h ^ seed, internal::HASH_SECRET[1] + pilot * 0x9E3779B97F4A7C15ULL), table_size);
+    }
+
+    template<typename Q> [[nodiscard]] const V *find_impl(const Q &key) const
+    {
+      if (m_entries.empty())
+        return nullptr;
+
+      const u64 h = m_hasher(key);
+      u64 slot = position(h, m_seed, m_pilots[bucket_of(h)], m_table_size);
+      if (slot >= m_entries.size())
+        slot = m_remap[static_cast<usize>(slot - m_entries.size())];
+
+      const value_type &entry = m_entries[static_cast<usize>(slot)];
+      if (!m_eq(entry.first, key))
+        return nullptr;
+      return &entry.second;
+    }
+
+    // One build attempt with `seed`. Returns false (not an error) when some bucket ran
+    // out of pilots, so the caller can retry with another seed.
+    auto try_build(Span<const value_type> items, const VecT<u64, usize, AllocatorT> &hashes, u64 seed,
+                   VecT<u32, usize, AllocatorT> &slot_to_item) -> Result<bool>
+    {
+      const usize n = items.size();
+      const usize bucket_count = bucket_count_for(n);
+      // ~1.5% spare slots keep the last, single-key buckets from searching for long.
+      const u64 table_size = n + n / 64 + 1;
+
+      m_seed = seed;
+      m_table_size = table_size;
+      m_pilots.clear();
+      m_pilots.resize(bucket_count, 0);
+
+      // Counting sort of keys by bucket.
+      VecT<u32, usize, AllocatorT> bucket_start;
+      bucket_start.resize(bucket_count + 1, 0);
+      VecT<u32, usize, AllocatorT> key_bucket;
+      key_bucket.reserve(n);
+      for (usize i = 0; i < n; ++i)
+      {
+        const u32 b = static_cast<u32>(bucket_of(hashes[i]));
+        key_bucket.push(b);
+        bucket_start[b + 1]++;
+      }
+      for (usize b = 0; b < bucket_count; ++b)
+        bucket_start[b + 1] += bucket_start[b];
+
+      VecT<u32, usize, AllocatorT> bucket_keys;
+      bucket_keys.resize(n, 0);
+      {
+        VecT<u32, usize, AllocatorT> cursor = bucket_start;
+        for (usize i = 0; i < n; ++i)
+          bucket_keys[cursor[key_bucket[i]]++] = static_cast<u32>(i);
+      }
+
+      // Largest buckets first, while the table is still empty.
+      u32 max_size = 0;
+      for (usize b = 0; b < bucket_count; ++b)
+        max_size = std::max(max_size, bucket_start[b + 1] - bucket_start[b]);
+
+      VecT<u32, usize, AllocatorT> order;
+      order.reserve(bucket_count);
+      for (u32 size = max_size; size > 0; --size)
+      {
+        for (usize b = 0; b < bucket_count; ++b)
+        {
+          if (bucket_start[b + 1] - bucket_start[b] == size)
+            order.push(static_cast<u32>(b));
+        }
+      }
+
+      VecT<u32, usize, AllocatorT> slot_owner;
+      slot_owner.resize(static_cast<usize>(table_size), INDEX_INVALID);
+      // The pilot search only asks "is this slot free", so it probes a bitmap that stays
+      // in cache instead of the much larger owner array.
+      VecT<u64, usize, AllocatorT> taken;
+      taken.resize(static_cast<usize>((table_size + 63) / 64), 0);
+      u64 positions[64];
+      VecT<u64, usize, AllocatorT> big_positions;
+
+      for (const u32 b : order)
+      {
+        const u32 *keys = bucket_keys.data() + bucket_start[b];
+        const u32 size = bucket_start[b + 1] - bucket_start[b];
+
+        for (u32 i = 0; i < size; ++i)
+        {
+          for (u32 j = 0; j < i; ++j)
+          {
+            if (hashes[keys[i]] != hashes[keys[j]])
+              continue;
+            if (m_eq(items[keys[i]].first, items[keys[j]].first))
+              return fail("StaticMap: duplicate key");
+            return fail("StaticMap: two distinct keys share a 64-bit hash");
+          }
+        }
+
+        u64 *pos = positions;
+        if (size > 64)
+        {
+          big_positions.resize(size, 0);
+          pos = big_positions.data();
+        }
+
+        bool placed = false;
+        for (u32 pilot = 0; pilot <= MAX_PILOT && !placed; ++pilot)
+        {
+          placed = true;
+          for (u32 i = 0; i < size && placed; ++i)
+          {
+            pos[i] = position(hashes[keys[i]], seed, pilot, table_size);
+            if (taken[static_cast<usize>(pos[i] >> 6)] & (u64(1) << (pos[i] & 63)))
+              placed = false;
+            for (u32 j = 0; j < i && placed; ++j)
+            {
+              if (pos[j] == pos[i])
+                placed = false;
+            }
+          }
+
+          if (placed)
+          {
+            m_pilots[b] = static_cast<u16>(pilot);
+            for (u32 i = 0; i < size; ++i)
+            {
+              taken[static_cast<usize>(pos[i] >> 6)] |= u64(1) << (pos[i] & 63);
+              slot_owner[static_cast<usize>(pos[i])] = keys[i];
+            }
+          }
+        }
+
+        if (!placed)
+          return false;
+      }
+
+      // Make the hash minimal: move keys that landed at or past n into the holes below n.
+      m_remap.clear();
+      m_remap.resize(static_cast<usize>(table_size - n), 0);
+      usize hole = 0;
+      for (usize p = n; p < table_size; ++p)
+      {
+        if (slot_owner[p] == INDEX_INVALID)
+          continue;
+        while (slot_owner[hole] != INDEX_INVALID)
+          hole++;
+        slot_owner[hole] = slot_owner[p];
+        m_remap[p - n] = static_cast<u32>(hole);
+      }
+
+      slot_to_item.clear();
+      slot_to_item.reserve(n);
+      for (usize s = 0; s < n; ++s)
+        slot_to_item.push(slot_owner[s]);
+      return true;
+    }
+  };
+} // namespace au::containers
+
+namespace au
+{
+  template<typename K, typename V> using StaticMap = containers::StaticMap<K, V>;
+}
@@ -0,0 +1,408 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <auxid/containers/hash_base.hpp>
+
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+namespace au::containers
+{
+  /*
+  NOTE: String of at most N chars held entirely inside the object (plus the terminator);
+        it never allocates. Writes that do not fit are truncated to the capacity and
+        report it by returning false, so callers on real-time paths can detect a cut
+        without the failure path allocating either. Constructors truncate silently.
+  */
+  template<usize N> struct StaticString
+  {
+    static constexpr usize npos = StringView::npos;
+    static constexpr usize CAPACITY = N;
+
+    using value_type = char;
+    using size_type = usize;
+    using difference_type = isize;
+    using reference = char &;
+    using const_reference = const char &;
+    using pointer = char *;
+    using const_pointer = const char *;
+    using iterator = char *;
+    using const_iterator = const char *;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+    usize m_size = 0;
+    char m_data[N + 1] = {};
+
+public:
+    StaticString() = default;
+
+    StaticString(const char *str)
+    {
+      assign(StringView(str));
+    }
+
+    StaticString(const char *str, usize len)
+    {
+      assign(StringView(str, len));
+    }
+
+    StaticString(StringView sv)
+    {
+      assign(sv);
+    }
+
+public:
+    // Replaces the contents; false if `sv` had to be truncated.
+    bool assign(StringView sv)
+    {
+      m_size = 0;
+      return append(sv);
+    }
+
+    // Appends as much of `sv` as fits; false if any of it was cut.
+    bool append(StringView sv)
+    {
+      const usize room = N - m_size;
+      const usize count = sv.size() < room ? sv.size() : room;
+      if (count > 0)
+        std::memcpy(m_data + m_size, sv.data(), count);
+      m_size += count;
+      m_data[m_size] = '\0';
+      return count == sv.size();
+    }
+
+    // Appends formatted text, truncated to the remaining room; false if it was cut or
+    // the format failed.
+    bool append_vformat(const char *fmt, va_list args)
+    {
+      const int req_len = vsnprintf(m_data + m_size, N - m_size + 1, fmt, args);
+      if (req_len < 0)
+      {
+        m_data[m_size] = '\0';
+        return false;
+      }
+
+      const usize len = static_cast<usize>(req_len);
+      if (len > N - m_size)
+      {
+        m_size = N;
+        return false;
+      }
+      m_size += len;
+      return true;
+    }
+
+    bool append_format(const char *fmt, ...)
+    {
+      va_list args;
+      va_start(args, fmt);
+      const bool fit = append_vformat(fmt, args);
+      va_end(args);
+      return fit;
+    }
+
+    bool push(char c)
+    {
+      if (m_size >= N)
+        return false;
+      m_data[m_size++] = c;
+      m_data[m_size] = '\0';
+      return true;
+    }
+
+    bool push_back(char c)
+    {
+      return push(c);
+    }
+
+    void pop()
+    {
+      if (m_size > 0)
+        m_data[--m_size] = '\0';
+    }
+
+    void pop_back()
+    {
+      pop();
+    }
+
+    // Capacity is fixed; only checks that `new_cap` fits.
+    void reserve(usize new_cap)
+    {
+      if (new_cap > N)
+        panic("StaticString capacity exceeded");
+    }
+
+    void clear()
+    {
+      m_size = 0;
+      m_data[0] = '\0';
+    }
+
+    auto operator+=(StringView other) -> void
+    {
+      append(other);
+    }
+
+public:
+    [[nodiscard]] const char *c_str() const
+    {
+      return m_data;
+    }
+
+    [[nodiscard]] const char *data() const
+    {
+      return m_data;
+    }
+
+    [[nodiscard]] char *data()
+    {
+      return m_data;
+    }
+
+    [[nodiscard]] usize size() const
+    {
+      return m_size;
+    }
+
+    [[nodiscard]] usize length() const
+    {
+      return m_size;
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+      return m_size == 0;
+    }
+
+    [[nodiscard]] bool full() const
+    {
+      return m_size == N;
+    }
+
+    [[nodiscard]] static constexpr usize capacity()
+    {
+      return N;
+    }
+
+public:
+    char *begin()
+    {
+      return m_data;
+    }
+
+    char *end()
+    {
+      return m_data + m_size;
+    }
+
+    [[nodiscard]] const char *begin() const
+    {
+      return m_data;
+    }
+
+    [[nodiscard]] const char *end() const
+    {
+      return m_data + m_size;
+    }
+
+    [[nodiscard]] const_iterator cbegin() const noexcept
+    {
+      return begin();
+    }
+
+    [[nodiscard]] const_iterator cend() const noexcept
+    {
+      return end();
+    }
+
+    [[nodiscard]] reverse_iterator rbegin() noexcept
+    {
+      return reverse_iterator(end());
+    }
+
+    [[nodiscard]] reverse_iterator rend() noexcept
+    {
+      return reverse_iterator(begin());
+    }
+
+    [[nodiscard]] const_reverse_iterator rbegin() const noexcept
+    {
+      return const_reverse_iterator(end());
+    }
+
+    [[nodiscard]] const_reverse_iterator rend() const noexcept
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    [[nodiscard]] const_reverse_iterator crbegin() const noexcept
+    {
+      return rbegin();
+    }
+
+    [[nodiscard]] const_reverse_iterator crend() const noexcept
+    {
+      return rend();
+    }
+
+    [[nodiscard]] char &back()
+    {
+#if !defined(NDEBUG)
+      if (m_size == 0)
+        panic("StaticString::back() called on empty string");
+#endif
+      return m_data[m_size - 1];
+    }
+
+    [[nodiscard]] const char &back() const
+    {
+#if !defined(NDEBUG)
+      if (m_size == 0)
+        panic("StaticString::back() called on empty string");
+#endif
+      return m_data[m_size - 1];
+    }
+
+    operator Span<char>()
+    {
+      return Span<char>(m_data, m_size);
+    }
+
+    operator Span<const char>() const
+    {
+      return Span<const char>(m_data, m_size);
+    }
+
+    operator StringView() const
+    {
+      return StringView(m_data, m_size);
+    }
+
+    [[nodiscard]] Span<const char> as_span() const
+    {
+      return Span<const char>(m_data, m_size);
+    }
+
+    [[nodiscard]] Span<const u8> as_bytes() const
+    {
+      return Span<const u8>(reinterpret_cast<const u8 *>(m_data), m_size);
+    }
+
+    [[nodiscard]] usize find(char c, usize pos = 0) const
+    {
+      return StringView(m_data, m_size).find(c, pos);
+    }
+
+    [[nodiscard]] usize find(StringView v, usize pos = 0) const
+    {
+      return StringView(m_data, m_size).find(v, pos);
+    }
+
+    [[nodiscard]] usize find(const char *s, usize pos = 0) const
+    {
+      return StringView(m_data, m_size).find(s, pos);
+    }
+
+    [[nodiscard]] StringView substr(usize pos, usize count = npos) const
+    {
+      return StringView(m_data, m_size).substr(pos, count);
+    }
+
+public:
+    // Formats into a fresh StaticString, truncated to N chars.
+    static StaticString vformat(const char *fmt, va_list args)
+    {
+      StaticString res;
+      res.append_vformat(fmt, args);
+      return res;
+    }
+
+    static StaticString format(const char *fmt, ...)
+    {
+      va_list args;
+      va_start(args, fmt);
+      StaticString res = vformat(fmt, args);
+      va_end(args);
+      return res;
+    }
+  };
+
+  template<usize N, usize M> inline bool operator==(const StaticString<N> &lhs, const StaticString<M> &rhs)
+  {
+    return StringView(lhs) == StringView(rhs);
+  }
+
+  template<usize N> inline bool operator==(const StaticString<N> &lhs, StringView rhs)
+  {
+    return StringView(lhs) == rhs;
+  }
+
+  template<usize N> inline bool operator==(StringView lhs, const StaticString<N> &rhs)
+  {
+    return lhs == StringView(rhs);
+  }
+
+  template<usize N> inline bool operator==(const StaticString<N> &lhs, const char *rhs)
+  {
+    return StringView(lhs) == StringView(rhs);
+  }
+
+  template<usize N> inline bool operator==(const char *lhs, const StaticString<N> &rhs)
+  {
+    return StringView(lhs) == StringView(rhs);
+  }
+
+  template<usize N, typename A> inline bool operator==(const StaticString<N> &lhs, const StringT<A> &rhs)
+  {
+    return StringView(lhs) == StringView(rhs);
+  }
+
+  template<usize N, typename A> inline bool operator==(const StringT<A> &lhs, const StaticString<N> &rhs)
+  {
+    return StringView(lhs) == StringView(rhs);
+  }
+
+  template<usize N> struct Hash<StaticString<N>>
+  {
+    using is_transparent = void;
+
+    u64 operator()(StringView s) const
+    {
+      return hash_string_view(s);
+    }
+  };
+
+  template<usize N> struct EqualTo<StaticString<N>>
+  {
+    using is_transparent = void;
+
+    bool operator()(StringView lhs, StringView rhs) const
+    {
+      return lhs == rhs;
+    }
+  };
+} // namespace au::containers
+
+namespace au
+{
+  template<usize N> using StaticString = containers::StaticString<N>;
+} // namespace au
@@ -0,0 +1,421 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <auxid/containers/span.hpp>
+#include <auxid/pch.hpp>
+
+#include <cstring>
+#include <iterator>
+#include <limits>
+
+namespace au::containers
+{
+  /*
+  NOTE: VecT whose N element slots live inside the object; it never allocates. The
+        VecT-shaped calls (push, emplace_back, resize, reserve) panic when they would
+        exceed N, since that is a logic error on paths that must not allocate; the try_*
+        variants report overflow instead and leave the vector unchanged. Overflow is not
+        reported through Result, because building its error message allocates.
+  */
+  template<typename T, usize N, typename size_type = usize> class StaticVec
+  {
+    static_assert(N > 0, "StaticVec needs a capacity of at least one element");
+    static_assert(N <= static_cast<usize>(std::numeric_limits<size_type>::max()),
+                  "StaticVec capacity does not fit size_type");
+
+    size_type m_size = 0;
+    alignas(T) u8 m_storage[N * sizeof(T)];
+
+public:
+    using value_type = T;
+    using difference_type = isize;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using iterator = T *;
+    using const_iterator = const T *;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr usize CAPACITY = N;
+
+    StaticVec() = default;
+
+    explicit StaticVec(size_type init_size, const T &init_value = T{})
+    {
+      resize(init_size, init_value);
+    }
+
+    StaticVec(std::initializer_list<T> init)
+    {
+      if (init.size() > N)
+        panic("StaticVec capacity exceeded");
+      copy_from(init.begin(), static_cast<size_type>(init.size()));
+    }
+
+    StaticVec(StaticVec &&other) noexcept
+    {
+      move_from(other);
+    }
+
+    StaticVec &operator=(StaticVec &&other) noexcept
+    {
+      if (this != &other)
+      {
+        clear();
+        move_from(other);
+      }
+      return *this;
+    }
+
+    StaticVec(const StaticVec &other)
+    {
+      copy_from(other.data(), other.m_size);
+    }
+
+    StaticVec &operator=(const StaticVec &other)
+    {
+      if (this != &other)
+      {
+        clear();
+        copy_from(other.data(), other.m_size);
+      }
+      return *this;
+    }
+
+    ~StaticVec()
+    {
+      clear();
+    }
+
+public:
+    [[nodiscard]] StaticVec clone() const
+    {
+      return StaticVec(*this);
+    }
+
+    // Returns nullptr, constructing nothing, when the vector is full.
+    template<typename... Args> [[nodiscard]] T *try_emplace_back(Args &&...args)
+    {
+      if (m_size >= N)
+        return nullptr;
+      au::construct_at(&data()[m_size], std::forward<Args>(args)...);
+      return &data()[m_size++];
+    }
+
+    [[nodiscard]] bool try_push(const T &val)
+    {
+      return try_emplace_back(val) != nullptr;
+    }
+
+    [[nodiscard]] bool try_push(T &&val)
+    {
+      return try_emplace_back(std::move(val)) != nullptr;
+    }
+
+    // Fails, leaving the vector untouched, when `new_size` exceeds the capacity.
+    [[nodiscard]] bool try_resize(size_type new_size, const T &fill_val = T{})
+    {
+      if (new_size > N)
+        return false;
+      resize(new_size, fill_val);
+      return true;
+    }
+
+    template<typename... Args> T &emplace_back(Args &&...args)
+    {
+      T *slot = try_emplace_back(std::forward<Args>(args)...);
+      if (!slot)
+        panic("StaticVec capacity exceeded");
+      return *slot;
+    }
+
+    void push(const T &val)
+    {
+      emplace_back(val);
+    }
+
+    void push(T &&val)
+    {
+      emplace_back(std::move(val));
+    }
+
+    void push_back(const T &val)
+    {
+      emplace_back(val);
+    }
+
+    void push_back(T &&val)
+    {
+      emplace_back(std::move(val));
+    }
+
+    void pop()
+    {
+      if (m_size > 0)
+      {
+        m_size--;
+        if constexpr (!std::is_trivially_destructible_v<T>)
+        {
+          au::destroy_at(&data()[m_size]);
+        }
+      }
+    }
+
+    void pop_back()
+    {
+      pop();
+    }
+
+    void clear()
+    {
+      if constexpr (!std::is_trivially_destructible_v<T>)
+      {
+        for (size_type i = 0; i < m_size; ++i)
+        {
+          au::destroy_at(&data()[i]);
+        }
+      }
+      m_size = 0;
+    }
+
+    // Capacity is fixed; only checks that `new_cap` fits.
+    void reserve(size_type new_cap)
+    {
+      if (new_cap > N)
+        panic("StaticVec capacity exceeded");
+    }
+
+    void resize(size_type new_size)
+    {
+      if (new_size > N)
+        panic("StaticVec capacity exceeded");
+      for (size_type i = m_size; i < new_size; ++i)
+      {
+        au::construct_at(&data()[i]);
+      }
+      truncate(new_size);
+    }
+
+    void resize(size_type new_size, const T &fill_val)
+    {
+      if (new_size > N)
+        panic("StaticVec capacity exceeded");
+      for (size_type i = m_size; i < new_size; ++i)
+      {
+        au::construct_at(&data()[i], fill_val);
+      }
+      truncate(new_size);
+    }
+
+public:
+    [[nodiscard]] size_type size() const
+    {
+      return m_size;
+    }
+
+    [[nodiscard]] static constexpr size_type capacity()
+    {
+      return static_cast<size_type>(N);
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+      return m_size == 0;
+    }
+
+    [[nodiscard]] bool full() const
+    {
+      return m_size == N;
+    }
+
+    [[nodiscard]] T *data()
+    {
+      return reinterpret_cast<T *>(m_storage);
+    }
+
+    [[nodiscard]] const T *data() const
+    {
+      return reinterpret_cast<const T *>(m_storage);
+    }
+
+    T &operator[](size_type idx)
+    {
+#if !defined(NDEBUG)
+      if (idx >= m_size)
+        panic("StaticVec index out of bounds");
+#endif
+      return data()[idx];
+    }
+
+    const T &operator[](size_type idx) const
+    {
+#if !defined(NDEBUG)
+      if (idx >= m_size)
+        panic("StaticVec index out of bounds");
+#endif
+      return data()[idx];
+    }
+
+    T *begin()
+    {
+      return data();
+    }
+
+    T *end()
+    {
+      return data() + m_size;
+    }
+
+    const T *begin() const
+    {
+      return data();
+    }
+
+    const T *end() const
+    {
+      return data() + m_size;
+    }
+
+    [[nodiscard]] const_iterator cbegin() const noexcept
+    {
+      return begin();
+    }
+
+    [[nodiscard]] const_iterator cend() const noexcept
+    {
+      return end();
+    }
+
+    [[nodiscard]] reverse_iterator rbegin() noexcept
+    {
+      return reverse_iterator(end());
+    }
+
+    [[nodiscard]] reverse_iterator rend() noexcept
+    {
+      return reverse_iterator(begin());
+    }
+
+    [[nodiscard]] const_reverse_iterator rbegin() const noexcept
+    {
+      return const_reverse_iterator(end());
+    }
+
+    [[nodiscard]] const_reverse_iterator rend() const noexcept
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    [[nodiscard]] const_reverse_iterator crbegin() const noexcept
+    {
+      return rbegin();
+    }
+
+    [[nodiscard]] const_reverse_iterator crend() const noexcept
+    {
+      return rend();
+    }
+
+    T &back()
+    {
+      return data()[m_size - 1];
+    }
+
+    const T &back() const
+    {
+      return data()[m_size - 1];
+    }
+
+    operator Span<T>()
+    {
+      return Span<T>(data(), m_size);
+    }
+
+    operator Span<const T>() const
+    {
+      return Span<const T>(data(), m_size);
+    }
+
+    [[nodiscard]] Span<T> as_span()
+    {
+      return Span<T>(data(), m_size);
+    }
+
+    [[nodiscard]] Span<const T> as_span() const
+    {
+      return Span<const T>(data(), m_size);
+    }
+
+private:
+    // Destroys the elements past `new_size`, if any, and sets the size.
+    void truncate(size_type new_size)
+    {
+      if constexpr (!std::is_trivially_destructible_v<T>)
+      {
+        for (size_type i = new_size; i < m_size; ++i)
+        {
+          au::destroy_at(&data()[i]);
+        }
+      }
+      m_size = new_size;
+    }
+
+    void copy_from(const T *src, size_type count)
+    {
+      if constexpr (std::is_trivially_copyable_v<T>)
+      {
+        if (count > 0)
+          std::memcpy(data(), src, count * sizeof(T));
+      }
+      else
+      {
+        for (size_type i = 0; i < count; ++i)
+        {
+          au::construct_at(&data()[i], src[i]);
+        }
+      }
+      m_size = count;
+    }
+
+    // Moves `other`'s elements in and leaves it empty.
+    void move_from(StaticVec &other)
+    {
+      if constexpr (std::is_trivially_copyable_v<T>)
+      {
+        if (other.m_size > 0)
+          std::memcpy(data(), other.data(), other.m_size * sizeof(T));
+      }
+      else
+      {
+        for (size_type i = 0; i < other.m_size; ++i)
+        {
+          au::construct_at(&data()[i], std::move(other.data()[i]));
+        }
+      }
+      m_size = other.m_size;
+      other.clear();
+    }
+  };
+} // namespace au::containers
+
+namespace au
+{
+  template<typename T, usize N> using StaticVec = containers::StaticVec<T, N>;
+} // namespace au
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <auxid/compiler.hpp>
+#include <auxid/hash.hpp>
 #include <auxid/containers/span.hpp>
 #include <auxid/memory/heap.hpp>
 
@@ -35,8 +36,12 @@ namespace au
 
   namespace containers
   {
-    struct String;
-  }
+    template<typename AllocatorT = memory::HeapAllocator>
+      requires memory::AllocatorType<AllocatorT>
+    struct StringT;
+
+    using String = StringT<>;
+  } // namespace containers
 } // namespace au
 
 namespace au
@@ -235,19 +240,21 @@ public:
 
   inline u64 hash_string_view(StringView sv)
   {
-    u64 hash = 14695981039346656037ULL;
-    for (usize i = 0; i < sv.size(); ++i)
-    {
-      hash ^= static_cast<u8>(sv[i]);
-      hash *= 1099511628211ULL;
-    }
-    return hash;
+    return hash_bytes(sv.data(), sv.size(), hash_seed());
   }
 } // namespace au
 
 namespace au::containers
 {
-  struct String
+  /*
+  NOTE: Small-string-optimized string over any AllocatorType. Strings of up to
+        SSO_CAPACITY chars live inline and never touch the allocator; longer ones are
+        allocated from `AllocatorT`, so e.g. StringT<memory::ArenaRef<...>> can be
+        bump-allocated and dropped with the arena. Copies keep the source's allocator.
+  */
+  template<typename AllocatorT>
+    requires memory::AllocatorType<AllocatorT>
+  struct StringT
   {
     static constexpr usize npos = StringView::npos;
 
@@ -284,7 +291,7 @@ private:
       ShortLayout s;
     } m_storage;
 
-    AUXID_NO_UNIQUE_ADDRESS memory::HeapAllocator m_allocator;
+    AUXID_NO_UNIQUE_ADDRESS AllocatorT m_allocator;
 
     [[nodiscard]] bool is_short() const
     {
@@ -327,13 +334,19 @@ private:
     }
 
 public:
-    String()
+    StringT()
     {
       m_storage.s.size_shifted = 0;
       m_storage.s.data[0] = '\0';
     }
 
-    String(const char *str)
+    explicit StringT(AllocatorT allocator) : m_allocator(std::move(allocator))
+    {
+      m_storage.s.size_shifted = 0;
+      m_storage.s.data[0] = '\0';
+    }
+
+    StringT(const char *str, AllocatorT allocator = AllocatorT()) : m_allocator(std::move(allocator))
     {
       m_storage.s.size_shifted = 0;
       if (str)
@@ -342,7 +355,7 @@ public:
         m_storage.s.data[0] = '\0';
     }
 
-    String(const char *str, usize len)
+    StringT(const char *str, usize len, AllocatorT allocator = AllocatorT()) : m_allocator(std::move(allocator))
     {
       m_storage.s.size_shifted = 0;
 
@@ -356,13 +369,13 @@ public:
       }
     }
 
-    String(StringView sv)
+    StringT(StringView sv, AllocatorT allocator = AllocatorT()) : m_allocator(std::move(allocator))
     {
       m_storage.s.size_shifted = 0;
       assign(sv);
     }
 
-    String(String &&other) noexcept : m_allocator(static_cast<memory::HeapAllocator &&>(other.m_allocator))
+    StringT(StringT &&other) noexcept : m_allocator(std::move(other.m_allocator))
     {
       std::memcpy(&m_storage, &other.m_storage, sizeof(m_storage));
 
@@ -370,12 +383,12 @@ public:
       other.m_storage.s.data[0] = '\0';
     }
 
-    String &operator=(String &&other) noexcept
+    StringT &operator=(StringT &&other) noexcept
     {
       if (this != &other)
       {
         destroy();
-        m_allocator = static_cast<memory::HeapAllocator &&>(other.m_allocator);
+        m_allocator = std::move(other.m_allocator);
 
         std::memcpy(&m_storage, &other.m_storage, sizeof(m_storage));
         other.m_storage.s.size_shifted = 0;
@@ -384,13 +397,13 @@ public:
       return *this;
     }
 
-    String(const String &other)
+    StringT(const StringT &other) : m_allocator(other.m_allocator)
     {
       m_storage.s.size_shifted = 0;
       assign(StringView(other.data(), other.size()));
     }
 
-    String &operator=(const String &other)
+    StringT &operator=(const StringT &other)
     {
       if (this != &other)
       {
@@ -399,14 +412,14 @@ public:
       return *this;
     }
 
-    ~String()
+    ~StringT()
     {
       destroy();
     }
 
-    [[nodiscard]] String clone() const
+    [[nodiscard]] StringT clone() const
     {
-      String new_str;
+      StringT new_str(m_allocator);
       new_str.assign(StringView(get_data(), get_size()));
       return new_str;
     }
@@ -448,6 +461,12 @@ public:
       {
         const usize old_alloc_size = current_cap + 1;
 
+        if (memory::try_expand_in_place(m_allocator, m_storage.l.ptr, old_alloc_size, new_alloc_size, 1))
+        {
+          set_long_capacity(new_cap);
+          return;
+        }
+
         void *expanded = m_allocator.realloc(m_storage.l.ptr, old_alloc_size, new_alloc_size, 1);
 
         if (expanded)
@@ -557,6 +576,16 @@ public:
       return get_size() == 0;
     }
 
+    [[nodiscard]] usize capacity() const
+    {
+      return get_capacity();
+    }
+
+    [[nodiscard]] const AllocatorT &get_allocator() const
+    {
+      return m_allocator;
+    }
+
 public:
     void push(char c)
     {
@@ -748,9 +777,14 @@ public:
     }
 
 public:
-    static String vformat(const char *fmt, va_list args)
+    static StringT vformat(const char *fmt, va_list args)
+    {
+      return vformat(AllocatorT(), fmt, args);
+    }
+
+    static StringT vformat(AllocatorT allocator, const char *fmt, va_list args)
     {
-      String res;
+      StringT res(std::move(allocator));
       va_list args_copy;
 
       va_copy(args_copy, args);
@@ -773,11 +807,20 @@ public:
       return res;
     }
 
-    static String format(const char *fmt, ...)
+    static StringT format(const char *fmt, ...)
+    {
+      va_list args;
+      va_start(args, fmt);
+      StringT res = vformat(fmt, args);
+      va_end(args);
+      return res;
+    }
+
+    static StringT format(AllocatorT allocator, const char *fmt, ...)
     {
       va_list args;
       va_start(args, fmt);
-      String res = vformat(fmt, args);
+      StringT res = vformat(std::move(allocator), fmt, args);
       va_end(args);
       return res;
     }
@@ -799,75 +842,77 @@ namespace au
 
 namespace au::containers
 {
-  inline bool operator==(const String &lhs, const String &rhs)
+  template<typename A, typename B> inline bool operator==(const StringT<A> &lhs, const StringT<B> &rhs)
   {
-    if (&lhs == &rhs)
+    if (static_cast<const void *>(&lhs) == static_cast<const void *>(&rhs))
       return true;
     if (lhs.size() != rhs.size())
       return false;
     return StringView(lhs.data(), lhs.size()) == StringView(rhs.data(), rhs.size());
   }
 
-  inline bool operator==(const String &lhs, StringView rhs)
+  template<typename A> inline bool operator==(const StringT<A> &lhs, StringView rhs)
   {
     return StringView(lhs.data(), lhs.size()) == rhs;
   }
 
-  inline bool operator==(StringView lhs, const String &rhs)
+  template<typename A> inline bool operator==(StringView lhs, const StringT<A> &rhs)
   {
     return lhs == StringView(rhs.data(), rhs.size());
   }
 
-  inline bool operator==(const String &lhs, const char *rhs)
+  template<typename A> inline bool operator==(const StringT<A> &lhs, const char *rhs)
   {
     return StringView(lhs.data(), lhs.size()) == StringView(rhs);
   }
 
-  inline bool operator==(const char *lhs, const String &rhs)
+  template<typename A> inline bool operator==(const char *lhs, const StringT<A> &rhs)
   {
     return StringView(lhs) == StringView(rhs.data(), rhs.size());
   }
 
-  inline String operator+(const String &lhs, StringView rhs)
+  // Concatenations allocate the result from the allocator of their String operand (the
+  // left one when both are Strings).
+  template<typename A> inline StringT<A> operator+(const StringT<A> &lhs, StringView rhs)
   {
-    String result;
+    StringT<A> result(lhs.get_allocator());
     result.reserve(lhs.size() + rhs.size());
     result.append(lhs);
     result.append(rhs);
     return result;
   }
 
-  inline String operator+(StringView lhs, const String &rhs)
+  template<typename A> inline StringT<A> operator+(StringView lhs, const StringT<A> &rhs)
   {
-    String result;
+    StringT<A> result(rhs.get_allocator());
     result.reserve(lhs.size() + rhs.size());
     result.append(lhs);
     result.append(rhs);
     return result;
   }
 
-  inline String operator+(const String &lhs, const String &rhs)
+  template<typename A, typename B> inline StringT<A> operator+(const StringT<A> &lhs, const StringT<B> &rhs)
   {
-    String result;
+    StringT<A> result(lhs.get_allocator());
     result.reserve(lhs.size() + rhs.size());
     result.append(lhs);
     result.append(rhs);
     return result;
   }
 
-  inline String operator+(const char *lhs, const String &rhs)
+  template<typename A> inline StringT<A> operator+(const char *lhs, const StringT<A> &rhs)
   {
     return StringView(lhs) + rhs;
   }
 
-  inline String operator+(const String &lhs, const char *rhs)
+  template<typename A> inline StringT<A> operator+(const StringT<A> &lhs, const char *rhs)
   {
     return lhs + StringView(rhs);
   }
 
-  inline String operator+(const String &lhs, char rhs)
+  template<typename A> inline StringT<A> operator+(const StringT<A> &lhs, char rhs)
   {
-    String result;
+    StringT<A> result(lhs.get_allocator());
     result.reserve(lhs.size() + 1);
     result.append(lhs);
     result.push(rhs);
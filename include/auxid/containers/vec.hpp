@@ -47,6 +47,11 @@ public:
 
     explicit VecT() = default;
 
+    // For stateful allocators (e.g. memory::ArenaRef); stateless ones are default-constructed.
+    explicit VecT(AllocatorT allocator) : m_allocator(std::move(allocator))
+    {
+    }
+
     explicit VecT(size_type init_size, const T& init_value = T{})
     {
       resize(init_size, init_value);
@@ -101,7 +106,7 @@ public:
       return *this;
     }
 
-    VecT(const VecT &other)
+    VecT(const VecT &other) : m_allocator(other.m_allocator)
     {
       reserve(other.m_size);
 
@@ -223,6 +228,14 @@ public:
       if (new_cap <= m_capacity)
         return;
 
+      // Growing in place never touches the elements, so it is tried for every T.
+      if (m_data &&
+          memory::try_expand_in_place(m_allocator, m_data, m_capacity * sizeof(T), new_cap * sizeof(T), alignof(T)))
+      {
+        m_capacity = new_cap;
+        return;
+      }
+
       if constexpr (std::is_trivially_copyable_v<T>)
       {
         if (m_data)
@@ -314,6 +327,11 @@ public:
       return m_size;
     }
 
+    [[nodiscard]] const AllocatorT &get_allocator() const
+    {
+      return m_allocator;
+    }
+
     [[nodiscard]] size_type capacity() const
     {
       return m_capacity;
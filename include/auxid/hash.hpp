@@ -0,0 +1,169 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <auxid/pch.hpp>
+
+#include <cstring>
+
+namespace au
+{
+  namespace internal
+  {
+    // Defined in libauxid. Mixes process-specific entropy (ASLR, clock, pid).
+    auto generate_hash_seed() -> u64;
+
+    // 64x64 -> 128 bit multiply, returning the low half in `a` and the high half in `b`.
+    inline void mum(u64 &a, u64 &b)
+    {
+#if defined(__SIZEOF_INT128__)
+      const __uint128_t r = static_cast<__uint128_t>(a) * b;
+      a = static_cast<u64>(r);
+      b = static_cast<u64>(r >> 64);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_AMD64))
+      a = _umul128(a, b, &b);
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+      const u64 lo = a * b;
+      b = __umulh(a, b);
+      a = lo;
+#else
+      const u64 ha = a >> 32, hb = b >> 32, la = static_cast<u32>(a), lb = static_cast<u32>(b);
+      const u64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+      const u64 t = rl + (rm0 << 32);
+      u64 c = t < rl;
+      const u64 lo = t + (rm1 << 32);
+      c += lo < t;
+      b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+      a = lo;
+#endif
+    }
+
+    inline u64 mix(u64 a, u64 b)
+    {
+      mum(a, b);
+      return a ^ b;
+    }
+
+    inline u64 read_u64(const u8 *p)
+    {
+      u64 v;
+      std::memcpy(&v, p, sizeof(v));
+      return v;
+    }
+
+    inline u64 read_u32(const u8 *p)
+    {
+      u32 v;
+      std::memcpy(&v, p, sizeof(v));
+      return v;
+    }
+
+    inline u64 read_small(const u8 *p, usize len)
+    {
+      return (static_cast<u64>(p[0]) << 16) | (static_cast<u64>(p[len >> 1]) << 8) | p[len - 1];
+    }
+
+    inline constexpr u64 HASH_SECRET[4] = {0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL,
+                                           0x4d5a2da51de1aa47ULL};
+  } // namespace internal
+
+  // Per-process random seed used by Hash<T> for strings and raw bytes, so that
+  // bucket placement cannot be predicted from outside the process (HashDoS).
+  // Define AUXID_HASH_SEED to a constant to get reproducible hashes across runs.
+  inline u64 hash_seed()
+  {
+#if defined(AUXID_HASH_SEED)
+    return static_cast<u64>(AUXID_HASH_SEED);
+#else
+    static const u64 s_seed = internal::generate_hash_seed();
+    return s_seed;
+#endif
+  }
+
+  // 64-bit hash of `len` bytes. Follows the structure of wyhash (public domain):
+  // up to 16 bytes are folded with overlapping loads and a single 128-bit multiply,
+  // longer inputs are consumed 48 bytes per iteration across three independent
+  // multiply lanes, so throughput is bound by load bandwidth, not a dependency chain.
+  inline u64 hash_bytes(const void *data, usize len, u64 seed)
+  {
+    using namespace internal;
+
+    const u8 *p = static_cast<const u8 *>(data);
+    seed ^= mix(seed ^ HASH_SECRET[0], HASH_SECRET[1]);
+
+    u64 a;
+    u64 b;
+
+    if (len <= 16)
+    {
+      if (len >= 4)
+      {
+        const usize mid = (len >> 3) << 2;
+        a = (read_u32(p) << 32) | read_u32(p + mid);
+        b = (read_u32(p + len - 4) << 32) | read_u32(p + len - 4 - mid);
+      }
+      else if (len > 0)
+      {
+        a = read_small(p, len);
+        b = 0;
+      }
+      else
+      {
+        a = 0;
+        b = 0;
+      }
+    }
+    else
+    {
+      usize i = len;
+      if (i > 48)
+      {
+        u64 see1 = seed;
+        u64 see2 = seed;
+        do
+        {
+          seed = mix(read_u64(p) ^ HASH_SECRET[1], read_u64(p + 8) ^ seed);
+          see1 = mix(read_u64(p + 16) ^ HASH_SECRET[2], read_u64(p + 24) ^ see1);
+          see2 = mix(read_u64(p + 32) ^ HASH_SECRET[3], read_u64(p + 40) ^ see2);
+          p += 48;
+          i -= 48;
+        } while (i > 48);
+        seed ^= see1 ^ see2;
+      }
+
+      while (i > 16)
+      {
+        seed = mix(read_u64(p) ^ HASH_SECRET[1], read_u64(p + 8) ^ seed);
+        i -= 16;
+        p += 16;
+      }
+
+      a = read_u64(p + i - 16);
+      b = read_u64(p + i - 8);
+    }
+
+    a ^= HASH_SECRET[1];
+    b ^= seed;
+    mum(a, b);
+    return mix(a ^ HASH_SECRET[0] ^ len, b ^ HASH_SECRET[1]);
+  }
+
+  inline u64 hash_bytes(const void *data, usize len)
+  {
+    return hash_bytes(data, len, hash_seed());
+  }
+} // namespace au
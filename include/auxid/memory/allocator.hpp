@@ -26,4 +26,22 @@ namespace au::memory
     { v.realloc(ptr, size, size, align) } -> std::same_as<void *>;
     { v.free(ptr, size, align) } -> std::same_as<void>;
   };
+
+  // Optional capability: grow the block at `ptr` to `new_size` without moving it, returning
+  // false (and leaving the block untouched) when that is not possible. Lets containers
+  // grow without relocating elements, whatever their type.
+  template<typename T>
+  concept ExpandableAllocatorType =
+      AllocatorType<T> && requires(T v, void *ptr, usize size, usize align) {
+        { v.try_expand_in_place(ptr, size, size, align) } -> std::same_as<bool>;
+      };
+
+  template<typename AllocatorT>
+  inline bool try_expand_in_place(AllocatorT &allocator, void *ptr, usize old_size, usize new_size, usize align)
+  {
+    if constexpr (ExpandableAllocatorType<AllocatorT>)
+      return allocator.try_expand_in_place(ptr, old_size, new_size, align);
+    else
+      return false;
+  }
 } // namespace au::memory
\ No newline at end of file
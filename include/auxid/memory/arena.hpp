@@ -16,6 +16,9 @@
 #pragma once
 
 #include <auxid/memory/allocator.hpp>
+#include <auxid/memory/heap.hpp>
+
+#include <cstring>
 
 namespace au::memory
 {
@@ -54,14 +57,26 @@ public:
       return ptr;
     }
 
+    // Grows or shrinks in place when `ptr` is the most recent allocation; fails otherwise.
     inline void *realloc(void *ptr, usize old_size, usize new_size, usize align)
     {
-      AU_UNUSED(ptr);
-      AU_UNUSED(old_size);
-      AU_UNUSED(new_size);
       AU_UNUSED(align);
 
-      return nullptr;
+      u8 *p = static_cast<u8 *>(ptr);
+      if (!p || p + old_size != buffer + offset)
+        return nullptr;
+
+      const usize start = static_cast<usize>(p - buffer);
+      if (new_size > length - start)
+        return nullptr;
+
+      offset = start + new_size;
+      return ptr;
+    }
+
+    inline bool try_expand_in_place(void *ptr, usize old_size, usize new_size, usize align)
+    {
+      return realloc(ptr, old_size, new_size, align) != nullptr;
     }
 
     inline void free(void *ptr, usize size, usize align)
@@ -78,4 +93,329 @@ public:
   };
 
   static_assert(AllocatorType<ArenaAllocator>, "Allocator class must conform to AllocatorT");
+
+  // Copyable allocator handle onto an arena that outlives it; what containers should hold.
+  template<typename ArenaT> class ArenaRef
+  {
+    ArenaT *m_arena = nullptr;
+
+public:
+    // No default: a handle without an arena would crash on first use.
+    ArenaRef() = delete;
+
+    explicit ArenaRef(ArenaT &arena) : m_arena(&arena)
+    {
+    }
+
+    inline void *alloc(usize size)
+    {
+      return m_arena->alloc(size);
+    }
+
+    inline void *alloc(usize size, usize align)
+    {
+      return m_arena->alloc(size, align);
+    }
+
+    inline void *realloc(void *ptr, usize old_size, usize new_size, usize align)
+    {
+      return m_arena->realloc(ptr, old_size, new_size, align);
+    }
+
+    inline bool try_expand_in_place(void *ptr, usize old_size, usize new_size, usize align)
+    {
+      return m_arena->try_expand_in_place(ptr, old_size, new_size, align);
+    }
+
+    inline void free(void *ptr, usize size, usize align)
+    {
+      m_arena->free(ptr, size, align);
+    }
+
+    [[nodiscard]] ArenaT *arena() const
+    {
+      return m_arena;
+    }
+  };
+
+  /*
+  NOTE: Bump allocator over a chain of blocks taken from `UpstreamT`. When the current
+        block is full a new one is chained, each twice the size of the last (up to
+        MAX_BLOCK_SIZE; larger requests get a block of their own). Rewinding keeps the
+        released blocks for reuse, so a steady-state request loop stops calling upstream
+        after warm-up. Not thread-safe.
+
+        Containers hold allocators by value, so hand them an ArenaRef (see ref()) rather
+        than the arena itself.
+  */
+  template<typename UpstreamT = HeapAllocator>
+    requires AllocatorType<UpstreamT>
+  class ChainedArenaAllocator
+  {
+    struct Block
+    {
+      Block *prev;
+      usize capacity;
+      usize used;
+    };
+
+    static constexpr usize BLOCK_ALIGN = 16;
+    static constexpr usize HEADER_SIZE = (sizeof(Block) + BLOCK_ALIGN - 1) & ~(BLOCK_ALIGN - 1);
+
+public:
+    static constexpr usize DEFAULT_BLOCK_SIZE = 4096;
+    static constexpr usize MAX_BLOCK_SIZE = usize(64) << 20;
+
+    struct Marker
+    {
+      Block *block = nullptr;
+      usize used = 0;
+    };
+
+private:
+    Block *m_current = nullptr;
+    // Blocks released by rewind(), kept for reuse until trim() or destruction.
+    Block *m_free = nullptr;
+    usize m_next_block_size;
+    // Start of the most recent allocation, for in-place realloc/free.
+    u8 *m_last = nullptr;
+
+    AUXID_NO_UNIQUE_ADDRESS UpstreamT m_upstream;
+
+public:
+    explicit ChainedArenaAllocator(usize initial_block_size = DEFAULT_BLOCK_SIZE)
+        : m_next_block_size(initial_block_size < HEADER_SIZE * 2 ? HEADER_SIZE * 2 : initial_block_size)
+    {
+    }
+
+    ChainedArenaAllocator(const ChainedArenaAllocator &) = delete;
+    ChainedArenaAllocator &operator=(const ChainedArenaAllocator &) = delete;
+
+    ~ChainedArenaAllocator()
+    {
+      release_chain(m_current);
+      release_chain(m_free);
+    }
+
+public:
+    inline void *alloc(usize size)
+    {
+      return alloc(size, BLOCK_ALIGN);
+    }
+
+    inline void *alloc(usize size, usize align)
+    {
+      if (m_current)
+      {
+        if (void *p = bump(m_current, size, align))
+          return p;
+      }
+
+      acquire_block(size + align);
+      return bump(m_current, size, align);
+    }
+
+    // In place when `ptr` is the most recent allocation and its block has room; otherwise
+    // copies into a fresh allocation (the old bytes stay until the next rewind).
+    inline void *realloc(void *ptr, usize old_size, usize new_size, usize align)
+    {
+      if (!ptr)
+        return alloc(new_size, align);
+
+      if (try_expand_in_place(ptr, old_size, new_size, align))
+        return ptr;
+
+      void *fresh = alloc(new_size, align);
+      std::memcpy(fresh, ptr, old_size < new_size ? old_size : new_size);
+      return fresh;
+    }
+
+    // Succeeds only for the most recent allocation while its block has room.
+    inline bool try_expand_in_place(void *ptr, usize old_size, usize new_size, usize align)
+    {
+      AU_UNUSED(old_size);
+      AU_UNUSED(align);
+
+      if (!ptr || ptr != m_last)
+        return false;
+      const usize start = static_cast<usize>(static_cast<u8 *>(ptr) - block_data(m_current));
+      if (new_size > m_current->capacity - start)
+        return false;
+      m_current->used = start + new_size;
+      return true;
+    }
+
+    // Only the most recent allocation is actually reclaimed; anything else waits for rewind().
+    inline void free(void *ptr, usize size, usize align)
+    {
+      AU_UNUSED(size);
+      AU_UNUSED(align);
+
+      if (ptr && ptr == m_last)
+      {
+        m_current->used = static_cast<usize>(static_cast<u8 *>(ptr) - block_data(m_current));
+        m_last = nullptr;
+      }
+    }
+
+public:
+    [[nodiscard]] Marker save_marker() const
+    {
+      return Marker{m_current, m_current ? m_current->used : 0};
+    }
+
+    // Frees everything allocated since `marker` was taken. Markers must be rewound in
+    // LIFO order; a marker taken before an earlier rewind point is still valid.
+    void rewind(Marker marker)
+    {
+      while (m_current != marker.block)
+      {
+        Block *prev = m_current->prev;
+        m_current->prev = m_free;
+        m_free = m_current;
+        m_current = prev;
+      }
+
+      if (m_current)
+        m_current->used = marker.used;
+      m_last = nullptr;
+    }
+
+    void reset()
+    {
+      rewind(Marker{});
+    }
+
+    // Returns the blocks kept around by rewind() to the upstream allocator.
+    void trim()
+    {
+      release_chain(m_free);
+      m_free = nullptr;
+    }
+
+    [[nodiscard]] usize bytes_used() const
+    {
+      usize total = 0;
+      for (const Block *b = m_current; b; b = b->prev)
+        total += b->used;
+      return total;
+    }
+
+    [[nodiscard]] usize bytes_reserved() const
+    {
+      usize total = 0;
+      for (const Block *b = m_current; b; b = b->prev)
+        total += b->capacity + HEADER_SIZE;
+      for (const Block *b = m_free; b; b = b->prev)
+        total += b->capacity + HEADER_SIZE;
+      return total;
+    }
+
+    [[nodiscard]] ArenaRef<ChainedArenaAllocator> ref()
+    {
+      return ArenaRef<ChainedArenaAllocator>(*this);
+    }
+
+private:
+    static u8 *block_data(Block *b)
+    {
+      return reinterpret_cast<u8 *>(b) + HEADER_SIZE;
+    }
+
+    void *bump(Block *b, usize size, usize align)
+    {
+      u8 *data = block_data(b);
+      const uintptr_t curr = reinterpret_cast<uintptr_t>(data) + b->used;
+      const usize padding = static_cast<usize>((align - (curr & (align - 1))) & (align - 1));
+
+      if (padding > b->capacity - b->used || size > b->capacity - b->used - padding)
+        return nullptr;
+
+      u8 *p = data + b->used + padding;
+      b->used += padding + size;
+      m_last = p;
+      return p;
+    }
+
+    void acquire_block(usize min_capacity)
+    {
+      // Reuse a kept block when one is large enough.
+      for (Block **link = &m_free; *link; link = &(*link)->prev)
+      {
+        Block *b = *link;
+        if (b->capacity >= min_capacity)
+        {
+          *link = b->prev;
+          push_block(b);
+          return;
+        }
+      }
+
+      usize block_size = m_next_block_size;
+      while (block_size - HEADER_SIZE < min_capacity && block_size < MAX_BLOCK_SIZE)
+        block_size *= 2;
+      if (block_size - HEADER_SIZE < min_capacity)
+        block_size = min_capacity + HEADER_SIZE;
+
+      if (m_next_block_size < MAX_BLOCK_SIZE)
+        m_next_block_size *= 2;
+
+      Block *b = static_cast<Block *>(m_upstream.alloc(block_size, BLOCK_ALIGN));
+      if (!b)
+        panic("ChainedArenaAllocator: upstream allocation failed");
+      b->capacity = block_size - HEADER_SIZE;
+      push_block(b);
+    }
+
+    void push_block(Block *b)
+    {
+      b->used = 0;
+      b->prev = m_current;
+      m_current = b;
+    }
+
+    void release_chain(Block *b)
+    {
+      while (b)
+      {
+        Block *prev = b->prev;
+        m_upstream.free(b, b->capacity + HEADER_SIZE, BLOCK_ALIGN);
+        b = prev;
+      }
+    }
+  };
+
+  // Rewinds the arena to where it was when the scope was opened.
+  template<typename ArenaT> class ArenaScope
+  {
+    ArenaT &m_arena;
+    typename ArenaT::Marker m_marker;
+
+public:
+    explicit ArenaScope(ArenaT &arena) : m_arena(arena), m_marker(arena.save_marker())
+    {
+    }
+
+    ~ArenaScope()
+    {
+      m_arena.rewind(m_marker);
+    }
+
+    ArenaScope(const ArenaScope &) = delete;
+    ArenaScope &operator=(const ArenaScope &) = delete;
+
+    [[nodiscard]] ArenaT &arena() const
+    {
+      return m_arena;
+    }
+
+    [[nodiscard]] ArenaRef<ArenaT> ref() const
+    {
+      return ArenaRef<ArenaT>(m_arena);
+    }
+  };
+
+  static_assert(AllocatorType<ChainedArenaAllocator<>>, "Allocator class must conform to AllocatorT");
+  static_assert(AllocatorType<ArenaRef<ChainedArenaAllocator<>>>, "Allocator class must conform to AllocatorT");
+  static_assert(ExpandableAllocatorType<ArenaRef<ChainedArenaAllocator<>>>, "ArenaRef must forward try_expand_in_place");
 } // namespace au::memory
\ No newline at end of file
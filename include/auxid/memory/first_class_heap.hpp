@@ -0,0 +1,177 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <auxid/memory/heap.hpp>
+
+#if !RPMALLOC_FIRST_CLASS_HEAPS
+#  error "FirstClassHeap requires rpmalloc built with RPMALLOC_FIRST_CLASS_HEAPS=1 (set by linking libauxid)"
+#endif
+
+namespace au::memory
+{
+  struct HeapStatistics
+  {
+    usize allocated_bytes = 0;
+    usize committed_bytes = 0;
+    usize mapped_bytes = 0;
+  };
+
+  // Copyable allocator handle onto a FirstClassHeap that outlives it.
+  class FirstClassHeapAllocator
+  {
+    rpmalloc_heap_t *m_heap = nullptr;
+
+public:
+    FirstClassHeapAllocator() = default;
+
+    explicit FirstClassHeapAllocator(rpmalloc_heap_t *heap) : m_heap(heap)
+    {
+    }
+
+    inline void *alloc(usize size)
+    {
+      return rpmalloc_heap_alloc(m_heap, size);
+    }
+
+    inline void *alloc(usize size, usize align)
+    {
+      if (align <= RPMALLOC_NATURAL_ALIGN)
+        return rpmalloc_heap_alloc(m_heap, size);
+      return rpmalloc_heap_aligned_alloc(m_heap, align, size);
+    }
+
+    inline void *realloc(void *ptr, usize old_size, usize new_size, usize align)
+    {
+      AU_UNUSED(old_size);
+      if (align <= RPMALLOC_NATURAL_ALIGN)
+        return rpmalloc_heap_realloc(m_heap, ptr, new_size, 0);
+      return rpmalloc_heap_aligned_realloc(m_heap, ptr, align, new_size, 0);
+    }
+
+    inline bool try_expand_in_place(void *ptr, usize old_size, usize new_size, usize align)
+    {
+      AU_UNUSED(old_size);
+      AU_UNUSED(align);
+      return ptr && rpmalloc_usable_size(ptr) >= new_size;
+    }
+
+    inline void free(void *ptr, usize size, usize align)
+    {
+      AU_UNUSED(size);
+      AU_UNUSED(align);
+      rpmalloc_heap_free(m_heap, ptr);
+    }
+
+    [[nodiscard]] rpmalloc_heap_t *heap() const
+    {
+      return m_heap;
+    }
+  };
+
+  /*
+  NOTE: An rpmalloc first-class heap owned by one subsystem. Everything allocated from it
+        can be dropped at once with free_all() (or by destroying the heap) without
+        visiting individual blocks, and its pages are never shared with other heaps, so
+        one subsystem's churn cannot fragment another's.
+
+        rpmalloc's heap API is not thread-safe: a heap and every allocator handle onto it
+        must only be used by one thread at a time.
+
+        Containers hold allocators by value, so hand them allocator() rather than the
+        heap itself, and make sure they are gone (or leaked) before free_all().
+  */
+  class FirstClassHeap
+  {
+    rpmalloc_heap_t *m_heap;
+
+public:
+    // Whether statistics() reports real numbers (Auxid_ENABLE_HEAP_STATISTICS).
+#if RPMALLOC_HEAP_STATISTICS
+    static constexpr bool HAS_STATISTICS = true;
+#else
+    static constexpr bool HAS_STATISTICS = false;
+#endif
+
+    FirstClassHeap() : m_heap(rpmalloc_heap_acquire())
+    {
+    }
+
+    ~FirstClassHeap()
+    {
+      destroy();
+    }
+
+    FirstClassHeap(FirstClassHeap &&other) noexcept : m_heap(other.m_heap)
+    {
+      other.m_heap = nullptr;
+    }
+
+    FirstClassHeap &operator=(FirstClassHeap &&other) noexcept
+    {
+      if (this != &other)
+      {
+        destroy();
+        m_heap = other.m_heap;
+        other.m_heap = nullptr;
+      }
+      return *this;
+    }
+
+    FirstClassHeap(const FirstClassHeap &) = delete;
+    FirstClassHeap &operator=(const FirstClassHeap &) = delete;
+
+public:
+    [[nodiscard]] FirstClassHeapAllocator allocator() const
+    {
+      return FirstClassHeapAllocator(m_heap);
+    }
+
+    // Releases every block allocated from this heap; the heap stays usable.
+    void free_all()
+    {
+      if (m_heap)
+        rpmalloc_heap_free_all(m_heap);
+    }
+
+    // All zeros unless HAS_STATISTICS.
+    [[nodiscard]] HeapStatistics statistics() const
+    {
+      if (!m_heap)
+        return {};
+      const rpmalloc_heap_statistics_t stats = rpmalloc_heap_statistics(m_heap);
+      return HeapStatistics{stats.allocated_size, stats.committed_size, stats.mapped_size};
+    }
+
+    [[nodiscard]] rpmalloc_heap_t *heap() const
+    {
+      return m_heap;
+    }
+
+private:
+    void destroy()
+    {
+      if (!m_heap)
+        return;
+      rpmalloc_heap_free_all(m_heap);
+      rpmalloc_heap_release(m_heap);
+      m_heap = nullptr;
+    }
+  };
+
+  static_assert(AllocatorType<FirstClassHeapAllocator>, "Allocator class must conform to AllocatorT");
+} // namespace au::memory
@@ -16,6 +16,7 @@
 #pragma once
 
 #include <auxid/memory/allocator.hpp>
+#include <auxid/memory/stats.hpp>
 
 #include <auxid/vendor/rpmalloc/rpmalloc.h>
 
@@ -27,11 +28,15 @@ namespace au::memory
   {
     inline void *alloc(usize size)
     {
+      if constexpr (STATISTICS_ENABLED)
+        internal::record_heap_alloc(size);
       return rpmalloc(size);
     }
 
     inline void *alloc(usize size, usize align)
     {
+      if constexpr (STATISTICS_ENABLED)
+        internal::record_heap_alloc(size);
       if (align <= RPMALLOC_NATURAL_ALIGN)
       {
         return ::rpmalloc(size);
@@ -41,13 +46,39 @@ namespace au::memory
 
     inline void *realloc(void *ptr, usize old_size, usize new_size, usize align)
     {
+      if constexpr (STATISTICS_ENABLED)
+      {
+        if (ptr)
+          internal::record_heap_free(old_size);
+        internal::record_heap_alloc(new_size);
+      }
       return rpaligned_realloc(ptr, align, new_size, old_size, 0);
     }
 
+    // rpmalloc rounds every request up to its size class (or page count, for huge
+    // blocks), so a block can grow in place as far as its usable size.
+    inline bool try_expand_in_place(void *ptr, usize old_size, usize new_size, usize align)
+    {
+      AU_UNUSED(align);
+      if (!ptr || rpmalloc_usable_size(ptr) < new_size)
+        return false;
+      if constexpr (STATISTICS_ENABLED)
+      {
+        internal::record_heap_free(old_size);
+        internal::record_heap_alloc(new_size);
+      }
+      return true;
+    }
+
     inline void free(void *ptr, usize size, usize align)
     {
       AU_UNUSED(size);
       AU_UNUSED(align);
+      if constexpr (STATISTICS_ENABLED)
+      {
+        if (ptr)
+          internal::record_heap_free(size);
+      }
       rpfree(ptr);
     }
   };
@@ -0,0 +1,146 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <auxid/memory/heap.hpp>
+
+#include <cstring>
+
+namespace au::memory
+{
+  // Granularity of large-page mappings: the x86-64/AArch64 huge page size.
+  constexpr usize LARGE_PAGE_SIZE = usize(2) << 20;
+
+  enum class LargePageKind : u8
+  {
+    // Explicit (hugetlbfs) huge pages from the pre-reserved pool.
+    Explicit,
+    // Transparent huge pages, requested with madvise(MADV_HUGEPAGE).
+    Transparent,
+    // Plain small pages: the platform offered neither.
+    None,
+  };
+
+  struct LargePageOptions
+  {
+    // Try the explicit huge page pool before falling back to transparent huge pages.
+    bool explicit_huge_pages = true;
+    // NUMA node to bind the pages to, or -1 to leave placement to the OS.
+    i32 numa_node = -1;
+  };
+
+  // Maps `size` bytes, rounded up to LARGE_PAGE_SIZE, backed by the largest pages
+  // available and falling back to small pages. NUMA binding is best effort: a node the
+  // machine does not have leaves placement to the OS. Returns nullptr only when the
+  // mapping itself fails. `kind` (optional) reports which pages were obtained.
+  auto map_large_pages(usize size, const LargePageOptions &options, LargePageKind *kind = nullptr) -> void *;
+  auto unmap_large_pages(void *ptr, usize size) -> void;
+
+  /*
+  NOTE: Allocator for big, randomly accessed buffers (large Vec and HashMap arrays), where
+        TLB misses rather than cache misses dominate. Requests of at least
+        LARGE_PAGE_THRESHOLD bytes get their own huge-page mapping, optionally bound to a
+        NUMA node; anything smaller goes to the regular heap.
+
+        Whether a block is a mapping is decided by its size alone, so free/realloc must be
+        passed the size it was allocated with (as the AllocatorT contract already demands).
+  */
+  class LargePageAllocator
+  {
+    // Alignment every platform's mapping guarantees, even on the small-page fallback.
+    static constexpr usize MAPPING_ALIGN = 4096;
+
+    LargePageOptions m_options{};
+
+public:
+    static constexpr usize LARGE_PAGE_THRESHOLD = LARGE_PAGE_SIZE;
+
+    LargePageAllocator() = default;
+
+    explicit LargePageAllocator(const LargePageOptions &options) : m_options(options)
+    {
+    }
+
+public:
+    inline void *alloc(usize size)
+    {
+      return alloc(size, RPMALLOC_NATURAL_ALIGN);
+    }
+
+    inline void *alloc(usize size, usize align)
+    {
+      if (!is_large(size, align))
+        return HeapAllocator{}.alloc(size, align);
+      return map_large_pages(size, m_options);
+    }
+
+    inline void *realloc(void *ptr, usize old_size, usize new_size, usize align)
+    {
+      if (!ptr)
+        return alloc(new_size, align);
+      if (!is_large(old_size, align) && !is_large(new_size, align))
+        return HeapAllocator{}.realloc(ptr, old_size, new_size, align);
+      if (try_expand_in_place(ptr, old_size, new_size, align))
+        return ptr;
+
+      void *fresh = alloc(new_size, align);
+      if (!fresh)
+        return nullptr;
+      std::memcpy(fresh, ptr, old_size < new_size ? old_size : new_size);
+      free(ptr, old_size, align);
+      return fresh;
+    }
+
+    // A mapping grows in place up to its rounded size. free() picks its path from the size
+    // alone, so a block never crosses LARGE_PAGE_THRESHOLD in place, in either direction.
+    inline bool try_expand_in_place(void *ptr, usize old_size, usize new_size, usize align)
+    {
+      if (!is_large(old_size, align))
+        return !is_large(new_size, align) && HeapAllocator{}.try_expand_in_place(ptr, old_size, new_size, align);
+      return ptr && is_large(new_size, align) && round_up(new_size) == round_up(old_size);
+    }
+
+    inline void free(void *ptr, usize size, usize align)
+    {
+      if (!ptr)
+        return;
+      if (is_large(size, align))
+        unmap_large_pages(ptr, size);
+      else
+        HeapAllocator{}.free(ptr, size, align);
+    }
+
+public:
+    [[nodiscard]] const LargePageOptions &options() const
+    {
+      return m_options;
+    }
+
+private:
+    [[nodiscard]] static bool is_large(usize size, usize align)
+    {
+      return size >= LARGE_PAGE_THRESHOLD && align <= MAPPING_ALIGN;
+    }
+
+    [[nodiscard]] static usize round_up(usize size)
+    {
+      return (size + LARGE_PAGE_SIZE - 1) & ~(LARGE_PAGE_SIZE - 1);
+    }
+  };
+
+  static_assert(AllocatorType<LargePageAllocator>, "Allocator class must conform to AllocatorT");
+} // namespace au::memory
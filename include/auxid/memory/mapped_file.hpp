@@ -0,0 +1,93 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <auxid/result.hpp>
+#include <auxid/containers/span.hpp>
+
+namespace au::memory
+{
+  /*
+  NOTE: Read-only, shared mapping of a whole file. Pages are faulted in on first touch
+        and shared through the page cache with every other process mapping the same
+        file. The mapping is page aligned.
+  */
+  class MappedFile
+  {
+    const u8 *m_data = nullptr;
+    usize m_size = 0;
+
+public:
+    MappedFile() = default;
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    MappedFile(MappedFile &&other) noexcept : m_data(other.m_data), m_size(other.m_size)
+    {
+      other.m_data = nullptr;
+      other.m_size = 0;
+    }
+
+    MappedFile &operator=(MappedFile &&other) noexcept
+    {
+      if (this != &other)
+      {
+        unmap();
+        m_data = other.m_data;
+        m_size = other.m_size;
+        other.m_data = nullptr;
+        other.m_size = 0;
+      }
+      return *this;
+    }
+
+    ~MappedFile()
+    {
+      unmap();
+    }
+
+public:
+    static auto open(const char *path) -> Result<MappedFile>;
+
+    [[nodiscard]] auto data() const -> const u8 *
+    {
+      return m_data;
+    }
+
+    [[nodiscard]] auto size() const -> usize
+    {
+      return m_size;
+    }
+
+    [[nodiscard]] auto as_span() const -> containers::Span<const u8>
+    {
+      return containers::Span<const u8>(m_data, m_size);
+    }
+
+private:
+    MappedFile(const u8 *data, usize size) : m_data(data), m_size(size)
+    {
+    }
+
+    auto unmap() -> void;
+  };
+
+  // Writes `bytes` to `path`, atomically replacing any existing file: processes that
+  // still map the old one keep seeing it.
+  auto write_file(const char *path, containers::Span<const u8> bytes) -> Result<void>;
+} // namespace au::memory
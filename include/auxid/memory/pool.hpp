@@ -0,0 +1,352 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <auxid/memory/box.hpp>
+#include <auxid/memory/heap.hpp>
+#include <auxid/thread/mutex.hpp>
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+
+namespace au::memory
+{
+  // Lets tests reproduce thread interleavings that are otherwise timing dependent.
+  struct FixedBlockPoolTestAccess;
+
+  /*
+  NOTE: Process-wide pool of fixed-size blocks, one instance per (BLOCK_SIZE, BLOCK_ALIGN).
+
+        Blocks are carved from slabs that double in size and are never returned upstream.
+        Each thread keeps a private free list, so the common alloc/free pair touches no
+        shared state. A thread's cache exchanges whole batches of blocks with a global
+        lock-free stack: a thread that frees more than it allocates (e.g. a consumer
+        releasing nodes built by a producer) hands batches back there, and a thread that
+        runs dry picks them up before carving fresh blocks.
+
+        The global stack links batches by 32-bit block index with a 32-bit ABA tag, so it
+        needs nothing wider than a 64-bit CAS.
+  */
+  template<usize BLOCK_SIZE, usize BLOCK_ALIGN> class FixedBlockPool
+  {
+    struct FreeBlock
+    {
+      FreeBlock *next;
+      // Only meaningful on the first block of a batch sitting in the global stack.
+      u32 next_batch;
+      u32 count;
+    };
+
+public:
+    static constexpr usize ALIGN = BLOCK_ALIGN > alignof(FreeBlock) ? BLOCK_ALIGN : alignof(FreeBlock);
+    static constexpr usize SIZE = ((BLOCK_SIZE > sizeof(FreeBlock) ? BLOCK_SIZE : sizeof(FreeBlock)) + ALIGN - 1) &
+                                  ~(ALIGN - 1);
+
+    // Blocks moved between a thread cache and the global stack at a time (~8 KiB worth).
+    static constexpr u32 BATCH = 8192 / SIZE >= 64 ? 64 : 8192 / SIZE <= 8 ? 8 : static_cast<u32>(std::bit_floor(8192 / SIZE));
+    static constexpr u32 CACHE_LIMIT = BATCH * 2;
+
+private:
+    static_assert(std::has_single_bit(BLOCK_ALIGN), "Block alignment must be a power of two");
+
+    // Slab k holds FIRST_SLAB_BLOCKS << k blocks; the first one is ~64 KiB.
+    static constexpr u64 FIRST_SLAB_BLOCKS = 65536 / SIZE > BATCH ? std::bit_floor(u64(65536 / SIZE)) : BATCH;
+    static constexpr u32 MAX_SLABS = 32;
+    static constexpr u64 MAX_BLOCKS = u64(UINT32_MAX) - 1;
+
+    struct ThreadCache
+    {
+      FreeBlock *head;
+      u32 count;
+    };
+
+    // Kept trivial so the hot path is a plain TLS access; the flusher below, touched only
+    // when the cache goes from empty to non-empty, returns it to the global stack when
+    // the thread exits.
+    static inline thread_local ThreadCache t_cache{};
+
+    struct CacheFlusher
+    {
+      void arm()
+      {
+      }
+
+      ~CacheFlusher()
+      {
+        if (t_cache.head)
+          instance().push_batch(t_cache.head, t_cache.count);
+        t_cache = ThreadCache{};
+      }
+    };
+
+    static inline thread_local CacheFlusher t_flusher;
+
+    // Low 32 bits: index + 1 of the first block of the top batch (0 when empty); high 32
+    // bits: a tag bumped on every successful pop.
+    std::atomic<u64> m_global{0};
+    std::atomic<u64> m_next_index{0};
+    std::atomic<u8 *> m_slabs[MAX_SLABS]{};
+    Mutex m_slab_mutex;
+
+    FixedBlockPool() = default;
+
+    friend struct FixedBlockPoolTestAccess;
+
+public:
+    FixedBlockPool(const FixedBlockPool &) = delete;
+    FixedBlockPool &operator=(const FixedBlockPool &) = delete;
+
+    // Deliberately immortal: thread caches may flush into it during process teardown.
+    static FixedBlockPool &instance()
+    {
+      static FixedBlockPool *s_pool = new FixedBlockPool();
+      return *s_pool;
+    }
+
+public:
+    [[nodiscard]] static void *alloc()
+    {
+      ThreadCache &cache = t_cache;
+      if (!cache.head)
+        instance().refill(cache);
+
+      FreeBlock *b = cache.head;
+      cache.head = b->next;
+      cache.count--;
+      return b;
+    }
+
+    static void free(void *ptr)
+    {
+      ThreadCache &cache = t_cache;
+      FreeBlock *b = static_cast<FreeBlock *>(ptr);
+      if (!cache.head)
+        t_flusher.arm();
+      b->next = cache.head;
+      cache.head = b;
+      if (++cache.count < CACHE_LIMIT)
+        return;
+
+      // Keep the most recently freed (cache-warm) blocks, hand the older ones back.
+      FreeBlock *keep_tail = cache.head;
+      for (u32 i = 1; i < CACHE_LIMIT - BATCH; ++i)
+        keep_tail = keep_tail->next;
+      FreeBlock *surplus = keep_tail->next;
+      keep_tail->next = nullptr;
+      cache.count = CACHE_LIMIT - BATCH;
+      instance().push_batch(surplus, BATCH);
+    }
+
+    // Blocks carved from slabs so far, free or not.
+    [[nodiscard]] usize blocks_reserved() const
+    {
+      return static_cast<usize>(m_next_index.load(std::memory_order_relaxed));
+    }
+
+private:
+    void refill(ThreadCache &cache)
+    {
+      t_flusher.arm();
+
+      u32 count = 0;
+      FreeBlock *batch = pop_batch(count);
+      if (!batch)
+        batch = carve_batch(count);
+      cache.head = batch;
+      cache.count = count;
+    }
+
+    void push_batch(FreeBlock *first, u32 count)
+    {
+      const u32 ref = index_of(first) + 1;
+      first->count = count;
+
+      std::atomic_ref<u32> next_batch(first->next_batch);
+      u64 head = m_global.load(std::memory_order_relaxed);
+      do
+      {
+        next_batch.store(static_cast<u32>(head), std::memory_order_relaxed);
+      } while (!m_global.compare_exchange_weak(head, (head & ~u64(UINT32_MAX)) | ref, std::memory_order_release,
+                                               std::memory_order_relaxed));
+    }
+
+    FreeBlock *pop_batch(u32 &count)
+    {
+      u64 head = m_global.load(std::memory_order_acquire);
+      while (static_cast<u32>(head) != 0)
+      {
+        FreeBlock *first = block_at(static_cast<u32>(head) - 1);
+        // May race with a thread that already popped and reused `first`; the tag makes
+        // our CAS fail in that case, so the value read is then discarded.
+        const u32 next = std::atomic_ref<u32>(first->next_batch).load(std::memory_order_relaxed);
+        const u64 desired = ((head >> 32) + 1) << 32 | next;
+        if (m_global.compare_exchange_weak(head, desired, std::memory_order_acquire, std::memory_order_acquire))
+        {
+          count = first->count;
+          return first;
+        }
+      }
+      return nullptr;
+    }
+
+    FreeBlock *carve_batch(u32 &count)
+    {
+      const u64 first_index = m_next_index.fetch_add(BATCH, std::memory_order_relaxed);
+      if (first_index + BATCH > MAX_BLOCKS)
+        panic("FixedBlockPool: block index space exhausted");
+
+      // BATCH divides every slab size, so a batch never straddles two slabs.
+      const u32 slab = slab_of(first_index);
+      if (!m_slabs[slab].load(std::memory_order_acquire))
+      {
+        LockGuard<Mutex> lock(m_slab_mutex);
+        if (!m_slabs[slab].load(std::memory_order_relaxed))
+        {
+          void *mem = HeapAllocator{}.alloc(static_cast<usize>((FIRST_SLAB_BLOCKS << slab) * SIZE), ALIGN);
+          if (!mem)
+            panic("FixedBlockPool: slab allocation failed");
+          m_slabs[slab].store(static_cast<u8 *>(mem), std::memory_order_release);
+        }
+      }
+
+      FreeBlock *first = block_at(static_cast<u32>(first_index));
+      FreeBlock *b = first;
+      for (u32 i = 1; i < BATCH; ++i)
+      {
+        b->next = reinterpret_cast<FreeBlock *>(reinterpret_cast<u8 *>(b) + SIZE);
+        b = b->next;
+      }
+      b->next = nullptr;
+      count = BATCH;
+      return first;
+    }
+
+    [[nodiscard]] static u32 slab_of(u64 index)
+    {
+      return static_cast<u32>(std::bit_width(index / FIRST_SLAB_BLOCKS + 1) - 1);
+    }
+
+    [[nodiscard]] static u64 slab_first_index(u32 slab)
+    {
+      return FIRST_SLAB_BLOCKS * ((u64(1) << slab) - 1);
+    }
+
+    [[nodiscard]] FreeBlock *block_at(u32 index) const
+    {
+      const u32 slab = slab_of(index);
+      u8 *base = m_slabs[slab].load(std::memory_order_acquire);
+      return reinterpret_cast<FreeBlock *>(base + static_cast<usize>(index - slab_first_index(slab)) * SIZE);
+    }
+
+    // Slabs may be filled out of order: a thread can claim indices in slab k and stall
+    // before allocating it while another thread allocates slab k + 1, so empty slabs are
+    // skipped rather than ending the search.
+    [[nodiscard]] u32 index_of(const FreeBlock *b) const
+    {
+      const u8 *p = reinterpret_cast<const u8 *>(b);
+      for (u32 slab = 0; slab < MAX_SLABS; ++slab)
+      {
+        const u8 *base = m_slabs[slab].load(std::memory_order_acquire);
+        if (!base)
+          continue;
+        const usize bytes = static_cast<usize>((FIRST_SLAB_BLOCKS << slab) * SIZE);
+        if (p >= base && p < base + bytes)
+          return static_cast<u32>(slab_first_index(slab) + static_cast<u64>(p - base) / SIZE);
+      }
+      panic("FixedBlockPool: pointer does not belong to this pool");
+      return 0;
+    }
+  };
+
+  /*
+  NOTE: Stateless allocator over FixedBlockPool<BLOCK_SIZE, BLOCK_ALIGN>. Requests that
+        fit a block are served by the pool; anything larger or more aligned falls through
+        to the heap, so the allocator stays safe to hand to any container. Routing looks
+        at (size, align), so free() must be given the pair alloc() got; alloc(size) counts
+        as align 1.
+  */
+  template<usize BLOCK_SIZE, usize BLOCK_ALIGN = alignof(std::max_align_t)> struct FixedBlockAllocator
+  {
+    using pool_type = FixedBlockPool<BLOCK_SIZE, BLOCK_ALIGN>;
+
+    [[nodiscard]] static bool fits(usize size, usize align)
+    {
+      return size <= pool_type::SIZE && align <= pool_type::ALIGN;
+    }
+
+    inline void *alloc(usize size)
+    {
+      return alloc(size, 1);
+    }
+
+    inline void *alloc(usize size, usize align)
+    {
+      if (fits(size, align))
+        return pool_type::alloc();
+      return HeapAllocator{}.alloc(size, align);
+    }
+
+    inline void *realloc(void *ptr, usize old_size, usize new_size, usize align)
+    {
+      if (!ptr)
+        return alloc(new_size, align);
+
+      const bool was_block = fits(old_size, align);
+      if (was_block && fits(new_size, align))
+        return ptr;
+      if (!was_block && !fits(new_size, align))
+        return HeapAllocator{}.realloc(ptr, old_size, new_size, align);
+
+      void *fresh = alloc(new_size, align);
+      std::memcpy(fresh, ptr, old_size < new_size ? old_size : new_size);
+      free(ptr, old_size, align);
+      return fresh;
+    }
+
+    // In place while the request still fits a block, or via the heap for heap blocks.
+    inline bool try_expand_in_place(void *ptr, usize old_size, usize new_size, usize align)
+    {
+      if (fits(old_size, align))
+        return ptr && fits(new_size, align);
+      return !fits(new_size, align) && HeapAllocator{}.try_expand_in_place(ptr, old_size, new_size, align);
+    }
+
+    inline void free(void *ptr, usize size, usize align)
+    {
+      if (!ptr)
+        return;
+      if (fits(size, align))
+        pool_type::free(ptr);
+      else
+        HeapAllocator{}.free(ptr, size, align);
+    }
+  };
+
+  template<typename T> using PoolAllocator = FixedBlockAllocator<sizeof(T), alignof(T)>;
+
+  template<typename T> using PoolBox = Box<T, BoxAllocatorDeleter<T, PoolAllocator<T>>>;
+
+  template<typename T, typename... Args> [[nodiscard]] PoolBox<T> make_pool_box(Args &&...args)
+  {
+    return make_box<T, PoolAllocator<T>>(PoolAllocator<T>{}, static_cast<Args &&>(args)...);
+  }
+
+  static_assert(AllocatorType<FixedBlockAllocator<64>>, "Allocator class must conform to AllocatorT");
+  static_assert(AllocatorType<PoolAllocator<u64>>, "Allocator class must conform to AllocatorT");
+} // namespace au::memory
@@ -0,0 +1,179 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <auxid/pch.hpp>
+
+#include <atomic>
+#include <bit>
+#include <cstdio>
+
+namespace au::memory
+{
+  // Set by configuring with -DAuxid_ENABLE_MEMORY_STATISTICS=ON, which also builds rpmalloc
+  // with ENABLE_STATISTICS. Off by default: every HeapAllocator call then updates counters.
+#if defined(AUXID_MEMORY_STATISTICS) && AUXID_MEMORY_STATISTICS
+  constexpr bool STATISTICS_ENABLED = true;
+#else
+  constexpr bool STATISTICS_ENABLED = false;
+#endif
+
+  // Requests are bucketed by power of two: class 0 is [1, 16] bytes, class k is
+  // (16 << (k - 1), 16 << k], and the last class takes everything larger.
+  constexpr usize STATS_SIZE_CLASS_COUNT = 24;
+
+  [[nodiscard]] constexpr usize stats_size_class_of(usize size)
+  {
+    if (size <= 16)
+      return 0;
+    const usize cls = static_cast<usize>(std::bit_width(size - 1)) - 4;
+    return cls < STATS_SIZE_CLASS_COUNT ? cls : STATS_SIZE_CLASS_COUNT - 1;
+  }
+
+  // Largest request size in `cls` (the last class is unbounded).
+  [[nodiscard]] constexpr usize stats_size_class_limit(usize cls)
+  {
+    return cls + 1 < STATS_SIZE_CLASS_COUNT ? usize(16) << cls : static_cast<usize>(-1);
+  }
+
+  struct AllocationCounters
+  {
+    u64 allocs = 0;
+    u64 frees = 0;
+    u64 bytes_allocated = 0;
+    u64 bytes_freed = 0;
+
+    // Signed: a thread that frees blocks allocated elsewhere goes negative.
+    [[nodiscard]] i64 live_count() const
+    {
+      return static_cast<i64>(allocs - frees);
+    }
+
+    [[nodiscard]] i64 live_bytes() const
+    {
+      return static_cast<i64>(bytes_allocated - bytes_freed);
+    }
+  };
+
+  // What rpmalloc itself reports, in bytes.
+  struct MappingStats
+  {
+    usize mapped = 0;
+    usize mapped_peak = 0;
+    // Running totals of pages committed to / decommitted from the OS.
+    usize committed = 0;
+    usize decommitted = 0;
+    usize active = 0;
+    usize active_peak = 0;
+    usize heap_count = 0;
+  };
+
+  struct MemoryStats
+  {
+    MappingStats mapping;
+    // HeapAllocator traffic from every thread, and from the calling thread alone.
+    AllocationCounters total;
+    AllocationCounters thread;
+    AllocationCounters size_classes[STATS_SIZE_CLASS_COUNT];
+  };
+
+  // All zeros unless STATISTICS_ENABLED.
+  auto stats() -> MemoryStats;
+
+  // stats() plus every registered AllocationTag, in human readable form.
+  auto dump_stats(FILE *out) -> void;
+
+  /*
+  NOTE: Counters for one allocation call site, fed by TrackingAllocator. Tags register
+        themselves on construction and are never unregistered, so they must have static
+        storage duration (see allocation_tag<T>()). Counting is always on for tagged
+        allocators, independent of STATISTICS_ENABLED.
+  */
+  class AllocationTag
+  {
+    const char *m_name;
+    std::atomic<u64> m_allocs{0};
+    std::atomic<u64> m_frees{0};
+    std::atomic<u64> m_bytes_allocated{0};
+    std::atomic<u64> m_bytes_freed{0};
+    std::atomic<u64> m_peak_bytes{0};
+    const AllocationTag *m_next = nullptr;
+
+public:
+    explicit AllocationTag(const char *name);
+
+    AllocationTag(const AllocationTag &) = delete;
+    AllocationTag &operator=(const AllocationTag &) = delete;
+
+    void record_alloc(usize size)
+    {
+      m_allocs.fetch_add(1, std::memory_order_relaxed);
+      const u64 allocated = m_bytes_allocated.fetch_add(size, std::memory_order_relaxed) + size;
+      const u64 live = allocated - m_bytes_freed.load(std::memory_order_relaxed);
+      u64 peak = m_peak_bytes.load(std::memory_order_relaxed);
+      while (live > peak && !m_peak_bytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+      {
+      }
+    }
+
+    void record_free(usize size)
+    {
+      m_frees.fetch_add(1, std::memory_order_relaxed);
+      m_bytes_freed.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] const char *name() const
+    {
+      return m_name;
+    }
+
+    [[nodiscard]] AllocationCounters counters() const
+    {
+      return AllocationCounters{m_allocs.load(std::memory_order_relaxed), m_frees.load(std::memory_order_relaxed),
+                                m_bytes_allocated.load(std::memory_order_relaxed),
+                                m_bytes_freed.load(std::memory_order_relaxed)};
+    }
+
+    // High-water mark of live bytes (approximate under concurrent frees).
+    [[nodiscard]] u64 peak_bytes() const
+    {
+      return m_peak_bytes.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] const AllocationTag *next() const
+    {
+      return m_next;
+    }
+  };
+
+  // Most recently registered tag first; walk with next().
+  auto allocation_tags() -> const AllocationTag *;
+
+  // The tag for `TagT`, which names itself with `static constexpr const char *NAME`.
+  template<typename TagT> auto allocation_tag() -> AllocationTag &
+  {
+    static AllocationTag s_tag(TagT::NAME);
+    return s_tag;
+  }
+
+  namespace internal
+  {
+    // HeapAllocator hooks; only called when STATISTICS_ENABLED.
+    auto record_heap_alloc(usize size) -> void;
+    auto record_heap_free(usize size) -> void;
+  } // namespace internal
+} // namespace au::memory
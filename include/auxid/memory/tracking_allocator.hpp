@@ -0,0 +1,99 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <auxid/memory/heap.hpp>
+#include <auxid/memory/stats.hpp>
+
+namespace au::memory
+{
+  /*
+  NOTE: Forwards to `UpstreamT` and counts every allocation against the AllocationTag of
+        `TagT`, so memory can be attributed to the container or subsystem that asked for
+        it. Stateless when `UpstreamT` is, so it slots into a container's allocator
+        parameter without touching call sites:
+
+          struct ParserTag { static constexpr const char *NAME = "parser"; };
+          VecT<Token, usize, TrackingAllocator<ParserTag>> tokens;
+
+        Counts requested sizes, not what the upstream rounds them up to.
+  */
+  template<typename TagT, typename UpstreamT = HeapAllocator>
+    requires AllocatorType<UpstreamT>
+  struct TrackingAllocator
+  {
+    AUXID_NO_UNIQUE_ADDRESS UpstreamT m_upstream;
+
+    TrackingAllocator() = default;
+
+    explicit TrackingAllocator(UpstreamT upstream) : m_upstream(std::move(upstream))
+    {
+    }
+
+    inline void *alloc(usize size)
+    {
+      void *ptr = m_upstream.alloc(size);
+      if (ptr)
+        allocation_tag<TagT>().record_alloc(size);
+      return ptr;
+    }
+
+    inline void *alloc(usize size, usize align)
+    {
+      void *ptr = m_upstream.alloc(size, align);
+      if (ptr)
+        allocation_tag<TagT>().record_alloc(size);
+      return ptr;
+    }
+
+    // A failed realloc leaves the block with the caller, so nothing is recorded.
+    inline void *realloc(void *ptr, usize old_size, usize new_size, usize align)
+    {
+      void *fresh = m_upstream.realloc(ptr, old_size, new_size, align);
+      if (fresh)
+      {
+        AllocationTag &tag = allocation_tag<TagT>();
+        if (ptr)
+          tag.record_free(old_size);
+        tag.record_alloc(new_size);
+      }
+      return fresh;
+    }
+
+    inline bool try_expand_in_place(void *ptr, usize old_size, usize new_size, usize align)
+    {
+      if (!memory::try_expand_in_place(m_upstream, ptr, old_size, new_size, align))
+        return false;
+      AllocationTag &tag = allocation_tag<TagT>();
+      tag.record_free(old_size);
+      tag.record_alloc(new_size);
+      return true;
+    }
+
+    inline void free(void *ptr, usize size, usize align)
+    {
+      if (ptr)
+        allocation_tag<TagT>().record_free(size);
+      m_upstream.free(ptr, size, align);
+    }
+
+    [[nodiscard]] static const AllocationTag &tag()
+    {
+      return allocation_tag<TagT>();
+    }
+  };
+} // namespace au::memory
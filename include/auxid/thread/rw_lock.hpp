@@ -0,0 +1,135 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+
+#include <auxid/pch.hpp>
+
+#include <auxid/vendor/tinycthread/tinycthread.h>
+
+#include <atomic>
+
+namespace au
+{
+  /*
+  NOTE: Writer-preferring reader/writer spin lock for short critical sections. A pending
+        writer blocks new readers, so a steady stream of lookups cannot starve it. Not
+        recursive; never hold it across anything that may block.
+  */
+  class RwSpinLock
+  {
+    static constexpr u32 WRITER = 1u << 31;
+    // After this many pause hints a waiter yields its timeslice, so a preempted holder
+    // can finish when there are more runnable threads than cores.
+    static constexpr u32 SPINS_BEFORE_YIELD = 64;
+
+    std::atomic<u32> m_state{0};
+
+    static void backoff(u32 &spins)
+    {
+      if (++spins < SPINS_BEFORE_YIELD)
+      {
+        compiler::cpu_relax();
+      }
+      else
+      {
+        spins = 0;
+        thrd_yield();
+      }
+    }
+
+public:
+    RwSpinLock() = default;
+
+    RwSpinLock(const RwSpinLock &) = delete;
+    RwSpinLock &operator=(const RwSpinLock &) = delete;
+
+    void lock()
+    {
+      u32 spins = 0;
+      u32 state = m_state.load(std::memory_order_relaxed);
+      while (true)
+      {
+        if (!(state & WRITER) &&
+            m_state.compare_exchange_weak(state, state | WRITER, std::memory_order_acquire, std::memory_order_relaxed))
+          break;
+        backoff(spins);
+        state = m_state.load(std::memory_order_relaxed);
+      }
+
+      // Writer bit is ours; wait for the readers that got in before us.
+      while (m_state.load(std::memory_order_acquire) != WRITER)
+        backoff(spins);
+    }
+
+    bool try_lock()
+    {
+      u32 expected = 0;
+      return m_state.compare_exchange_strong(expected, WRITER, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    void unlock()
+    {
+      m_state.fetch_and(~WRITER, std::memory_order_release);
+    }
+
+    void lock_shared()
+    {
+      u32 spins = 0;
+      while (true)
+      {
+        if (!(m_state.fetch_add(1, std::memory_order_acquire) & WRITER))
+          return;
+
+        m_state.fetch_sub(1, std::memory_order_relaxed);
+        while (m_state.load(std::memory_order_relaxed) & WRITER)
+          backoff(spins);
+      }
+    }
+
+    bool try_lock_shared()
+    {
+      if (!(m_state.fetch_add(1, std::memory_order_acquire) & WRITER))
+        return true;
+      m_state.fetch_sub(1, std::memory_order_relaxed);
+      return false;
+    }
+
+    void unlock_shared()
+    {
+      m_state.fetch_sub(1, std::memory_order_release);
+    }
+  };
+
+  template<typename MutexType> class SharedLockGuard
+  {
+    MutexType &m_mutex;
+
+public:
+    explicit SharedLockGuard(MutexType &m) : m_mutex(m)
+    {
+      m_mutex.lock_shared();
+    }
+
+    ~SharedLockGuard()
+    {
+      m_mutex.unlock_shared();
+    }
+
+    SharedLockGuard(const SharedLockGuard &) = delete;
+    SharedLockGuard &operator=(const SharedLockGuard &) = delete;
+  };
+} // namespace au
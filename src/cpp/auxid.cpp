@@ -32,9 +32,23 @@ namespace au::auxid
     Logger *logger;
   };
 
+  // The pair of scratch arenas owned by one initialized thread.
+  struct ThreadScratch
+  {
+    ScratchArena arenas[2];
+
+    explicit ThreadScratch(usize block_size) : arenas{ScratchArena(block_size), ScratchArena(block_size)}
+    {
+    }
+  };
+
+  // Scratch is reached on every ScratchAllocator call, so it bypasses the thread_data map.
+  static thread_local ThreadScratch *t_scratch = nullptr;
+
   struct State
   {
     Mutex logger_mutex{};
+    RuntimeConfig config{};
     Mut<Thread::ThreadID> main_thread_id{};
     Mut<HashMap<Thread::ThreadID, ThreadData>> thread_data{};
   };
@@ -45,6 +59,16 @@ namespace au::auxid
     return s_state;
   }
 
+  auto set_runtime_config(const RuntimeConfig &config) -> void
+  {
+    get_state().config = config;
+  }
+
+  auto get_runtime_config() -> const RuntimeConfig &
+  {
+    return get_state().config;
+  }
+
   auto initialize_main_thread() -> void
   {
     auto &state = get_state();
@@ -58,8 +82,12 @@ namespace au::auxid
     state.thread_data[thread_id].logger = new Logger(state.logger_mutex);
 
 #if !defined(AUXID_USE_SYSTEM_MALLOC)
-    rpmalloc_initialize(nullptr);
+    rpmalloc_config_t rp_config{};
+    rp_config.enable_huge_pages = state.config.heap_huge_pages ? 1 : 0;
+    rpmalloc_initialize_config(nullptr, &rp_config);
 #endif
+
+    t_scratch = new ThreadScratch(state.config.scratch_arena_size);
   }
 
   auto terminate_main_thread() -> void
@@ -73,6 +101,9 @@ namespace au::auxid
 
     delete state.thread_data[thread_id].logger;
 
+    delete t_scratch;
+    t_scratch = nullptr;
+
 #if !defined(AUXID_USE_SYSTEM_MALLOC)
     rpmalloc_finalize();
 #endif
@@ -92,6 +123,8 @@ namespace au::auxid
 #if !defined(AUXID_USE_SYSTEM_MALLOC)
     rpmalloc_thread_initialize();
 #endif
+
+    t_scratch = new ThreadScratch(state.config.scratch_arena_size);
   }
 
   auto terminate_worker_thread() -> void
@@ -105,6 +138,9 @@ namespace au::auxid
 
     delete state.thread_data[thread_id].logger;
 
+    delete t_scratch;
+    t_scratch = nullptr;
+
 #if !defined(AUXID_USE_SYSTEM_MALLOC)
     rpmalloc_thread_finalize();
 #endif
@@ -124,6 +160,13 @@ namespace au::auxid
   {
     return *get_state().thread_data[Thread::get_calling_thread_id()].logger;
   }
+
+  auto get_thread_scratch(const ScratchArena *conflict) -> ScratchArena &
+  {
+    if (!t_scratch)
+      panic("get_thread_scratch: calling thread is not initialized");
+    return &t_scratch->arenas[0] == conflict ? t_scratch->arenas[1] : t_scratch->arenas[0];
+  }
 } // namespace au::auxid
 
 namespace au
@@ -0,0 +1,44 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/hash.hpp>
+
+#include <chrono>
+
+#if defined(_WIN32)
+#  include <process.h>
+#else
+#  include <unistd.h>
+#endif
+
+namespace au::internal
+{
+  auto generate_hash_seed() -> u64
+  {
+    const u64 local = 0;
+    const u64 clock = static_cast<u64>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+
+#if defined(_WIN32)
+    const u64 pid = static_cast<u64>(_getpid());
+#else
+    const u64 pid = static_cast<u64>(getpid());
+#endif
+
+    u64 seed = mix(clock ^ HASH_SECRET[0], reinterpret_cast<uintptr_t>(&local) ^ HASH_SECRET[1]);
+    seed = mix(seed ^ pid, reinterpret_cast<uintptr_t>(&generate_hash_seed) ^ HASH_SECRET[2]);
+    return seed;
+  }
+} // namespace au::internal
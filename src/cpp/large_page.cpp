@@ -0,0 +1,147 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/memory/large_page.hpp>
+
+#if defined(_WIN32)
+#  define WIN32_LEAN_AND_MEAN
+#  include <windows.h>
+#else
+#  include <sys/mman.h>
+#  include <unistd.h>
+#  if defined(__linux__)
+#    include <sys/syscall.h>
+#  endif
+#endif
+
+namespace au::memory
+{
+  namespace
+  {
+    auto round_to_large_page(usize size) -> usize
+    {
+      return (size + LARGE_PAGE_SIZE - 1) & ~(LARGE_PAGE_SIZE - 1);
+    }
+
+#if !defined(_WIN32)
+    // Transparent huge pages only back 2MB-aligned ranges, so over-map and trim.
+    auto map_aligned(usize length) -> void *
+    {
+      const usize padded = length + LARGE_PAGE_SIZE;
+      void *raw = mmap(nullptr, padded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (raw == MAP_FAILED)
+        return nullptr;
+
+      const uintptr_t start = reinterpret_cast<uintptr_t>(raw);
+      const uintptr_t aligned = (start + LARGE_PAGE_SIZE - 1) & ~(uintptr_t(LARGE_PAGE_SIZE) - 1);
+      const usize head = static_cast<usize>(aligned - start);
+      if (head)
+        munmap(raw, head);
+      if (padded - head > length)
+        munmap(reinterpret_cast<void *>(aligned + length), padded - head - length);
+      return reinterpret_cast<void *>(aligned);
+    }
+
+    // Must run before the first touch: mbind only steers pages that are not yet faulted in.
+    // Issued as a raw syscall so the library does not depend on libnuma.
+    auto bind_to_node(void *addr, usize length, i32 node) -> void
+    {
+#  if defined(__linux__) && defined(SYS_mbind)
+      constexpr unsigned long MPOL_BIND_MODE = 2;
+      constexpr usize MASK_BITS = 1024;
+      constexpr usize WORD_BITS = sizeof(unsigned long) * 8;
+
+      if (node < 0 || static_cast<usize>(node) >= MASK_BITS)
+        return;
+      unsigned long mask[MASK_BITS / WORD_BITS] = {};
+      mask[static_cast<usize>(node) / WORD_BITS] = 1UL << (static_cast<usize>(node) % WORD_BITS);
+      // The kernel reads maxnode - 1 bits.
+      syscall(SYS_mbind, addr, length, MPOL_BIND_MODE, mask, MASK_BITS + 1, 0);
+#  else
+      AU_UNUSED(addr);
+      AU_UNUSED(length);
+      AU_UNUSED(node);
+#  endif
+    }
+#endif
+  } // namespace
+
+  auto map_large_pages(usize size, const LargePageOptions &options, LargePageKind *kind) -> void *
+  {
+    const usize length = round_to_large_page(size);
+    LargePageKind obtained = LargePageKind::None;
+
+#if defined(_WIN32)
+    const DWORD node = options.numa_node >= 0 ? static_cast<DWORD>(options.numa_node) : NUMA_NO_PREFERRED_NODE;
+    void *addr = nullptr;
+
+    // Needs SeLockMemoryPrivilege; without it the call fails and small pages are used.
+    const SIZE_T large_min = GetLargePageMinimum();
+    if (options.explicit_huge_pages && large_min && length % large_min == 0)
+    {
+      addr = VirtualAllocExNuma(GetCurrentProcess(), nullptr, length, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES,
+                                PAGE_READWRITE, node);
+      if (addr)
+        obtained = LargePageKind::Explicit;
+    }
+    if (!addr)
+      addr = VirtualAllocExNuma(GetCurrentProcess(), nullptr, length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, node);
+#else
+    void *addr = nullptr;
+
+#  if defined(MAP_HUGETLB)
+    // Fails up front (rather than at fault time) when the hugetlb pool cannot cover it.
+    if (options.explicit_huge_pages)
+    {
+      addr = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+      if (addr == MAP_FAILED)
+        addr = nullptr;
+      else
+        obtained = LargePageKind::Explicit;
+    }
+#  endif
+
+    if (!addr)
+    {
+      addr = map_aligned(length);
+      if (!addr)
+        return nullptr;
+#  if defined(MADV_HUGEPAGE)
+      if (madvise(addr, length, MADV_HUGEPAGE) == 0)
+        obtained = LargePageKind::Transparent;
+#  endif
+    }
+
+    bind_to_node(addr, length, options.numa_node);
+#endif
+
+    if (kind)
+      *kind = obtained;
+    return addr;
+  }
+
+  auto unmap_large_pages(void *ptr, usize size) -> void
+  {
+    if (!ptr)
+      return;
+#if defined(_WIN32)
+    AU_UNUSED(size);
+    VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+    munmap(ptr, round_to_large_page(size));
+#endif
+  }
+} // namespace au::memory
@@ -14,6 +14,7 @@
 // limitations under the License.
 
 #include <auxid/auxid.hpp>
+#include <auxid/containers/static_string.hpp>
 
 namespace au
 {
@@ -34,11 +35,8 @@ namespace au
   {                                                                                                                    \
     va_list args;                                                                                                      \
     va_start(args, fmt);                                                                                               \
-    const auto msg = containers::String::vformat(fmt, args);                                                           \
+    vlog(ELevel::LEVEL_##level, fmt, args);                                                                            \
     va_end(args);                                                                                                      \
-    m_logger_mutex_ref.lock();                                                                                         \
-    m_handler(msg.c_str(), ELevel::LEVEL_##level);                                                                     \
-    m_logger_mutex_ref.unlock();                                                                                       \
   }
 
   LOG_FUNC_IMPL(trace, TRACE);
@@ -49,6 +47,29 @@ namespace au
 
 #undef LOG_FUNC_IMPL
 
+  auto Logger::vlog(ELevel level, const char *fmt, va_list args) -> void
+  {
+    // Keeps logging off the allocator (e.g. on audio threads) for typical messages.
+    va_list args_copy;
+    va_copy(args_copy, args);
+    containers::StaticString<INLINE_MESSAGE_CAPACITY> inline_msg;
+    const bool fits = inline_msg.append_vformat(fmt, args_copy);
+    va_end(args_copy);
+
+    if (fits)
+    {
+      m_logger_mutex_ref.lock();
+      m_handler(inline_msg.c_str(), level);
+      m_logger_mutex_ref.unlock();
+      return;
+    }
+
+    const auto msg = containers::String::vformat(fmt, args);
+    m_logger_mutex_ref.lock();
+    m_handler(msg.c_str(), level);
+    m_logger_mutex_ref.unlock();
+  }
+
   auto Logger::default_handler(const char *msg, ELevel level) -> void
   {
     switch (level)
@@ -0,0 +1,129 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <auxid/memory/mapped_file.hpp>
+#include <auxid/containers/string.hpp>
+
+#include <stdio.h>
+
+#if defined(_WIN32)
+#  define WIN32_LEAN_AND_MEAN
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+namespace au::memory
+{
+  auto MappedFile::open(const char *path) -> Result<MappedFile>
+  {
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+      return fail("failed to open '%s' for mapping", path);
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+    {
+      CloseHandle(file);
+      return fail("cannot map '%s': empty or unreadable file", path);
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping)
+      return fail("failed to create a file mapping for '%s'", path);
+
+    void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view)
+      return fail("failed to map a view of '%s'", path);
+
+    return MappedFile(static_cast<const u8 *>(view), static_cast<usize>(file_size.QuadPart));
+#else
+    const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+      return fail("failed to open '%s' for mapping", path);
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0)
+    {
+      close(fd);
+      return fail("cannot map '%s': empty or unreadable file", path);
+    }
+
+    void *addr = mmap(nullptr, static_cast<usize>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED)
+      return fail("failed to mmap '%s'", path);
+
+    return MappedFile(static_cast<const u8 *>(addr), static_cast<usize>(st.st_size));
+#endif
+  }
+
+  auto MappedFile::unmap() -> void
+  {
+    if (!m_data)
+      return;
+#if defined(_WIN32)
+    UnmapViewOfFile(m_data);
+#else
+    munmap(const_cast<u8 *>(m_data), m_size);
+#endif
+    m_data = nullptr;
+    m_size = 0;
+  }
+
+  auto write_file(const char *path, containers::Span<const u8> bytes) -> Result<void>
+  {
+    // Other processes may have the old file mapped MAP_SHARED; truncating it in place
+    // would fault them. Write a sibling and rename it over `path`, so they keep the old
+    // inode and new opens see the new contents.
+#if defined(_WIN32)
+    const String tmp_path = String::format("%s.tmp.%lu", path, static_cast<unsigned long>(GetCurrentProcessId()));
+#else
+    const String tmp_path = String::format("%s.tmp.%ld", path, static_cast<long>(getpid()));
+#endif
+
+    FILE *file = fopen(tmp_path.c_str(), "wb");
+    if (!file)
+      return fail("failed to open '%s' for writing", tmp_path.c_str());
+
+    const usize written = bytes.size() ? fwrite(bytes.data(), 1, bytes.size(), file) : 0;
+    const bool flushed = fflush(file) == 0;
+    const bool closed = fclose(file) == 0;
+
+    if (written != bytes.size() || !flushed || !closed)
+    {
+      remove(tmp_path.c_str());
+      return fail("failed to write %zu bytes to '%s'", bytes.size(), tmp_path.c_str());
+    }
+
+#if defined(_WIN32)
+    const bool replaced = MoveFileExA(tmp_path.c_str(), path, MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    const bool replaced = rename(tmp_path.c_str(), path) == 0;
+#endif
+    if (!replaced)
+    {
+      remove(tmp_path.c_str());
+      return fail("failed to replace '%s'", path);
+    }
+    return {};
+  }
+} // namespace au::memory
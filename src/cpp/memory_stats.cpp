@@ -0,0 +1,137 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/memory/stats.hpp>
+
+#include <auxid/vendor/rpmalloc/rpmalloc.h>
+
+namespace au::memory
+{
+  namespace
+  {
+    struct AtomicCounters
+    {
+      std::atomic<u64> allocs{0};
+      std::atomic<u64> frees{0};
+      std::atomic<u64> bytes_allocated{0};
+      std::atomic<u64> bytes_freed{0};
+
+      [[nodiscard]] AllocationCounters load() const
+      {
+        return AllocationCounters{allocs.load(std::memory_order_relaxed), frees.load(std::memory_order_relaxed),
+                                  bytes_allocated.load(std::memory_order_relaxed),
+                                  bytes_freed.load(std::memory_order_relaxed)};
+      }
+    };
+
+    // Totals are derived from the size classes, so each event costs two relaxed adds.
+    AtomicCounters g_size_classes[STATS_SIZE_CLASS_COUNT];
+    thread_local AllocationCounters t_thread_counters;
+
+    std::atomic<const AllocationTag *> g_tags{nullptr};
+  } // namespace
+
+  AllocationTag::AllocationTag(const char *name) : m_name(name)
+  {
+    const AllocationTag *head = g_tags.load(std::memory_order_relaxed);
+    do
+    {
+      m_next = head;
+    } while (!g_tags.compare_exchange_weak(head, this, std::memory_order_release, std::memory_order_relaxed));
+  }
+
+  auto allocation_tags() -> const AllocationTag *
+  {
+    return g_tags.load(std::memory_order_acquire);
+  }
+
+  namespace internal
+  {
+    auto record_heap_alloc(usize size) -> void
+    {
+      AtomicCounters &cls = g_size_classes[stats_size_class_of(size)];
+      cls.allocs.fetch_add(1, std::memory_order_relaxed);
+      cls.bytes_allocated.fetch_add(size, std::memory_order_relaxed);
+      t_thread_counters.allocs++;
+      t_thread_counters.bytes_allocated += size;
+    }
+
+    auto record_heap_free(usize size) -> void
+    {
+      AtomicCounters &cls = g_size_classes[stats_size_class_of(size)];
+      cls.frees.fetch_add(1, std::memory_order_relaxed);
+      cls.bytes_freed.fetch_add(size, std::memory_order_relaxed);
+      t_thread_counters.frees++;
+      t_thread_counters.bytes_freed += size;
+    }
+  } // namespace internal
+
+  auto stats() -> MemoryStats
+  {
+    MemoryStats result;
+
+    rpmalloc_global_statistics_t global;
+    rpmalloc_global_statistics(&global);
+    result.mapping = MappingStats{global.mapped, global.mapped_peak, global.committed, global.decommitted,
+                                  global.active,  global.active_peak, global.heap_count};
+
+    for (usize i = 0; i < STATS_SIZE_CLASS_COUNT; ++i)
+    {
+      const AllocationCounters cls = g_size_classes[i].load();
+      result.size_classes[i] = cls;
+      result.total.allocs += cls.allocs;
+      result.total.frees += cls.frees;
+      result.total.bytes_allocated += cls.bytes_allocated;
+      result.total.bytes_freed += cls.bytes_freed;
+    }
+    result.thread = t_thread_counters;
+    return result;
+  }
+
+  auto dump_stats(FILE *out) -> void
+  {
+    const MemoryStats s = stats();
+
+    fprintf(out, "[memory] statistics %s\n", STATISTICS_ENABLED ? "enabled" : "disabled (Auxid_ENABLE_MEMORY_STATISTICS)");
+    fprintf(out, "  mapped      %12zu  (peak %zu)\n", s.mapping.mapped, s.mapping.mapped_peak);
+    fprintf(out, "  active      %12zu  (peak %zu)\n", s.mapping.active, s.mapping.active_peak);
+    fprintf(out, "  committed   %12zu  decommitted %zu\n", s.mapping.committed, s.mapping.decommitted);
+    fprintf(out, "  heaps       %12zu\n", s.mapping.heap_count);
+    fprintf(out, "  heap allocs %12llu  frees %llu  live bytes %lld\n", static_cast<unsigned long long>(s.total.allocs),
+            static_cast<unsigned long long>(s.total.frees), static_cast<long long>(s.total.live_bytes()));
+
+    for (usize i = 0; i < STATS_SIZE_CLASS_COUNT; ++i)
+    {
+      const AllocationCounters &cls = s.size_classes[i];
+      if (!cls.allocs)
+        continue;
+      if (i + 1 < STATS_SIZE_CLASS_COUNT)
+        fprintf(out, "  <= %-10zu", stats_size_class_limit(i));
+      else
+        fprintf(out, "  >  %-10zu", stats_size_class_limit(i - 1));
+      fprintf(out, " allocs %12llu  live %10lld  live bytes %lld\n", static_cast<unsigned long long>(cls.allocs),
+              static_cast<long long>(cls.live_count()), static_cast<long long>(cls.live_bytes()));
+    }
+
+    for (const AllocationTag *tag = allocation_tags(); tag; tag = tag->next())
+    {
+      const AllocationCounters c = tag->counters();
+      fprintf(out, "  tag %-20s allocs %10llu  live %8lld  live bytes %10lld  peak %llu\n", tag->name(),
+              static_cast<unsigned long long>(c.allocs), static_cast<long long>(c.live_count()),
+              static_cast<long long>(c.live_bytes()), static_cast<unsigned long long>(tag->peak_bytes()));
+    }
+  }
+} // namespace au::memory
@@ -0,0 +1,290 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <auxid/containers/shared_ring_buffer.hpp>
+
+#if defined(_WIN32)
+#  define WIN32_LEAN_AND_MEAN
+#  include <windows.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+#include <new>
+
+namespace au::containers
+{
+  namespace
+  {
+    // Largest ring accepted, so header + capacity still fits in a u32.
+    constexpr u32 MAX_CAPACITY = u32(1) << 30;
+
+    // The ControlBlock gets a whole page (allocation granule on Windows) to itself, so the
+    // data that follows can be mapped at a valid offset.
+    auto header_size() -> u32
+    {
+#if defined(_WIN32)
+      SYSTEM_INFO sys_info;
+      GetSystemInfo(&sys_info);
+      return sys_info.dwAllocationGranularity;
+#else
+      return static_cast<u32>(sysconf(_SC_PAGESIZE));
+#endif
+    }
+
+    auto round_capacity(u32 requested_capacity, u32 granule) -> u32
+    {
+      u32 capacity = 1;
+      while (capacity < requested_capacity)
+        capacity *= 2;
+      return capacity < granule ? granule : capacity;
+    }
+
+    auto close_handle(isize handle) -> void
+    {
+#if defined(_WIN32)
+      CloseHandle(reinterpret_cast<HANDLE>(handle));
+#else
+      close(static_cast<int>(handle));
+#endif
+    }
+
+    auto unlink_name(const String &name) -> void
+    {
+#if !defined(_WIN32)
+      if (!name.empty())
+        shm_unlink(name.c_str());
+#else
+      (void) name;
+#endif
+    }
+
+    // Maps [header | data] followed by a second view of the data. Returns nullptr on failure.
+    auto map_mirrored(isize handle, u32 header, u32 capacity) -> u8 *
+    {
+#if defined(_WIN32)
+      HANDLE mapping = reinterpret_cast<HANDLE>(handle);
+      // Another thread may take the reserved range between VirtualFree and the mapping.
+      for (u32 attempt = 0; attempt < 16; ++attempt)
+      {
+        void *address = VirtualAlloc(NULL, header + usize(capacity) * 2, MEM_RESERVE, PAGE_NOACCESS);
+        if (!address)
+          return nullptr;
+        VirtualFree(address, 0, MEM_RELEASE);
+
+        u8 *base = static_cast<u8 *>(address);
+        void *view1 = MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, 0, header + capacity, base);
+        void *view2 = MapViewOfFileEx(mapping, FILE_MAP_ALL_ACCESS, 0, header, capacity, base + header + capacity);
+        if (view1 && view2)
+          return base;
+
+        if (view1)
+          UnmapViewOfFile(view1);
+        if (view2)
+          UnmapViewOfFile(view2);
+      }
+      return nullptr;
+#else
+      const int fd = static_cast<int>(handle);
+      const usize total = header + usize(capacity) * 2;
+      void *address = mmap(NULL, total, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (address == MAP_FAILED)
+        return nullptr;
+
+      u8 *base = static_cast<u8 *>(address);
+      void *view1 = mmap(base, header + capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+      void *view2 = mmap(base + header + capacity, capacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd,
+                         static_cast<off_t>(header));
+      if (view1 == MAP_FAILED || view2 == MAP_FAILED)
+      {
+        munmap(base, total);
+        return nullptr;
+      }
+      return base;
+#endif
+    }
+
+    auto unmap_mirrored(u8 *base, u32 header, u32 capacity) -> void
+    {
+#if defined(_WIN32)
+      UnmapViewOfFile(base);
+      UnmapViewOfFile(base + header + capacity);
+#else
+      munmap(base, header + usize(capacity) * 2);
+#endif
+    }
+
+    // Reads the capacity the creator stored in the ControlBlock, or 0 if it cannot be mapped.
+    auto read_capacity(isize handle, u32 header) -> u32
+    {
+#if defined(_WIN32)
+      void *view = MapViewOfFile(reinterpret_cast<HANDLE>(handle), FILE_MAP_READ, 0, 0, header);
+      if (!view)
+        return 0;
+      const u32 capacity = static_cast<const ControlBlock *>(view)->consumer.capacity;
+      UnmapViewOfFile(view);
+      return capacity;
+#else
+      struct stat st;
+      if (fstat(static_cast<int>(handle), &st) != 0 || st.st_size < static_cast<off_t>(header))
+        return 0;
+
+      void *view = mmap(NULL, header, PROT_READ, MAP_SHARED, static_cast<int>(handle), 0);
+      if (view == MAP_FAILED)
+        return 0;
+      const u32 capacity = static_cast<const ControlBlock *>(view)->consumer.capacity;
+      munmap(view, header);
+
+      // A half-created object, or one that is not a ring at all.
+      if (static_cast<u64>(st.st_size) != u64(header) + capacity)
+        return 0;
+      return capacity;
+#endif
+    }
+  } // namespace
+
+  auto SharedRingBuffer::create(const char *name, const u32 requested_capacity) -> Result<SharedRingBuffer>
+  {
+    if (requested_capacity == 0 || requested_capacity > MAX_CAPACITY)
+      return fail("SharedRingBuffer: invalid capacity %u", requested_capacity);
+
+    const u32 header = header_size();
+    const u32 capacity = round_capacity(requested_capacity, header);
+
+#if defined(_WIN32)
+    HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, 0, header + capacity, name);
+    if (!mapping)
+      return fail("SharedRingBuffer: failed to create '%s'", name);
+    if (GetLastError() == ERROR_ALREADY_EXISTS)
+    {
+      CloseHandle(mapping);
+      return fail("SharedRingBuffer: '%s' already exists", name);
+    }
+    return init(reinterpret_cast<isize>(mapping), capacity, String());
+#else
+    const int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, 0600);
+    if (fd < 0)
+      return fail("SharedRingBuffer: failed to create '%s' (it may already exist)", name);
+    return init(fd, capacity, String(name));
+#endif
+  }
+
+  auto SharedRingBuffer::open(const char *name) -> Result<SharedRingBuffer>
+  {
+#if defined(_WIN32)
+    HANDLE mapping = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, name);
+    if (!mapping)
+      return fail("SharedRingBuffer: failed to open '%s'", name);
+    return attach(reinterpret_cast<isize>(mapping));
+#else
+    const int fd = shm_open(name, O_RDWR | O_CLOEXEC, 0);
+    if (fd < 0)
+      return fail("SharedRingBuffer: failed to open '%s'", name);
+    return attach(fd);
+#endif
+  }
+
+#if !defined(_WIN32)
+  auto SharedRingBuffer::create_anonymous(const u32 requested_capacity) -> Result<SharedRingBuffer>
+  {
+    if (requested_capacity == 0 || requested_capacity > MAX_CAPACITY)
+      return fail("SharedRingBuffer: invalid capacity %u", requested_capacity);
+
+    const int fd = memfd_create("auxid_shared_ring", MFD_CLOEXEC);
+    if (fd < 0)
+      return fail("SharedRingBuffer: failed to create memfd");
+    return init(fd, round_capacity(requested_capacity, header_size()), String());
+  }
+
+  auto SharedRingBuffer::open_fd(const int fd) -> Result<SharedRingBuffer>
+  {
+    const int own_fd = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+    if (own_fd < 0)
+      return fail("SharedRingBuffer: invalid fd %d", fd);
+    return attach(own_fd);
+  }
+#endif
+
+  auto SharedRingBuffer::init(isize handle, const u32 capacity, String owned_name) -> Result<SharedRingBuffer>
+  {
+    const u32 header = header_size();
+
+#if !defined(_WIN32)
+    if (ftruncate(static_cast<int>(handle), static_cast<off_t>(header) + capacity) != 0)
+    {
+      close_handle(handle);
+      unlink_name(owned_name);
+      return fail("SharedRingBuffer: failed to size shared memory");
+    }
+#endif
+
+    u8 *base = map_mirrored(handle, header, capacity);
+    if (!base)
+    {
+      close_handle(handle);
+      unlink_name(owned_name);
+      return fail("SharedRingBuffer: failed to map shared memory");
+    }
+
+    auto *cb = new (base) ControlBlock();
+    cb->producer.write_offset.store(0, std::memory_order_relaxed);
+    cb->consumer.read_offset.store(0, std::memory_order_relaxed);
+    // Attachers treat a zero capacity as "not initialized yet", so it is stored last.
+    std::atomic_thread_fence(std::memory_order_release);
+    cb->consumer.capacity = capacity;
+
+    return SharedRingBuffer(base, header, capacity, handle, std::move(owned_name));
+  }
+
+  auto SharedRingBuffer::attach(isize handle) -> Result<SharedRingBuffer>
+  {
+    const u32 header = header_size();
+    const u32 capacity = read_capacity(handle, header);
+    if (capacity < header || (capacity & (capacity - 1)) != 0 || capacity > MAX_CAPACITY)
+    {
+      close_handle(handle);
+      return fail("SharedRingBuffer: not an initialized shared ring");
+    }
+
+    u8 *base = map_mirrored(handle, header, capacity);
+    if (!base)
+    {
+      close_handle(handle);
+      return fail("SharedRingBuffer: failed to map shared memory");
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    return SharedRingBuffer(base, header, capacity, handle, String());
+  }
+
+  auto SharedRingBuffer::unmap() -> void
+  {
+    if (m_base)
+    {
+      unmap_mirrored(m_base, m_header_size, m_capacity);
+      m_base = nullptr;
+    }
+    if (m_handle != INVALID_HANDLE)
+    {
+      close_handle(m_handle);
+      m_handle = INVALID_HANDLE;
+    }
+    unlink_name(m_owned_name);
+    m_owned_name.clear();
+  }
+} // namespace au::containers
@@ -0,0 +1,148 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/utils/test.hpp>
+#include <auxid/containers/concurrent_hash_map.hpp>
+#include <auxid/containers/string.hpp>
+#include <auxid/memory/arena.hpp>
+#include <auxid/thread/thread.hpp>
+
+using namespace au;
+
+AUT_BEGIN_BLOCK(containers, concurrent_hash_map)
+
+auto test_basic_operations() -> bool
+{
+  ConcurrentHashMap<String, i32> map(3);
+  AUT_CHECK_EQ(map.shard_count(), 4);
+
+  AUT_CHECK(map.insert("one", 1));
+  AUT_CHECK(map.insert("two", 2));
+  AUT_CHECK_NOT(map.insert("one", 100));
+
+  auto one = map.get("one");
+  AUT_CHECK(one.has_value());
+  AUT_CHECK_EQ(*one, 1);
+  AUT_CHECK(map.get("three").is_none());
+
+  AUT_CHECK_NOT(map.insert_or_assign("two", 22));
+  AUT_CHECK(map.modify("two", [](i32 &v) { v += 1; }));
+
+  i32 seen = 0;
+  AUT_CHECK(map.visit("two", [&seen](const i32 &v) { seen = v; }));
+  AUT_CHECK_EQ(seen, 23);
+
+  AUT_CHECK(map.erase("one"));
+  AUT_CHECK_NOT(map.contains("one"));
+  AUT_CHECK_EQ(map.size(), 1);
+
+  return true;
+}
+
+auto test_parallel_disjoint_inserts() -> bool
+{
+  constexpr u32 THREADS = 4;
+  constexpr u32 PER_THREAD = 5000;
+
+  ConcurrentHashMap<u32, u32> map;
+  {
+    Vec<JThread> workers;
+    for (u32 t = 0; t < THREADS; ++t)
+    {
+      workers.push(JThread::create([&map, t]() {
+                     for (u32 i = 0; i < PER_THREAD; ++i)
+                       map.insert(t * PER_THREAD + i, i);
+                   }).unwrap());
+    }
+  }
+
+  AUT_CHECK_EQ(map.size(), THREADS * PER_THREAD);
+  for (u32 k = 0; k < THREADS * PER_THREAD; ++k)
+  {
+    auto v = map.get(k);
+    AUT_CHECK(v.has_value());
+    AUT_CHECK_EQ(*v, k % PER_THREAD);
+  }
+
+  return true;
+}
+
+auto test_parallel_readers_and_writers() -> bool
+{
+  constexpr u32 KEYS = 256;
+  constexpr u32 INCREMENTS = 2000;
+
+  ConcurrentHashMap<u32, u64> map(8);
+  for (u32 k = 0; k < KEYS; ++k)
+    map.insert(k, 0);
+
+  bool reader_ok = true;
+  {
+    Vec<JThread> workers;
+    for (u32 t = 0; t < 2; ++t)
+    {
+      workers.push(JThread::create([&map]() {
+                     for (u32 i = 0; i < INCREMENTS; ++i)
+                       map.modify(i % KEYS, [](u64 &v) { v++; });
+                   }).unwrap());
+    }
+    workers.push(JThread::create([&map, &reader_ok]() {
+                   for (u32 i = 0; i < INCREMENTS * 4; ++i)
+                   {
+                     if (!map.contains(i % KEYS))
+                       reader_ok = false;
+                   }
+                 }).unwrap());
+  }
+
+  AUT_CHECK(reader_ok);
+
+  u64 total = 0;
+  map.for_each([&total](const u32 &, const u64 &v) { total += v; });
+  AUT_CHECK_EQ(total, 2 * INCREMENTS);
+
+  return true;
+}
+
+auto test_stateful_allocator() -> bool
+{
+  using Arena = memory::ChainedArenaAllocator<>;
+  using ArenaMap = containers::ConcurrentHashMap<u32, u32, containers::Hash<u32>, containers::EqualTo<u32>,
+                                                 memory::ArenaRef<Arena>>;
+
+  // A default ArenaRef points at no arena, so every shard must get the map's allocator.
+  Arena arena(1 << 16);
+  ArenaMap map(memory::ArenaRef<Arena>(arena), 4);
+  const usize shards_only = arena.bytes_used();
+  for (u32 i = 0; i < 1000; ++i)
+    AUT_CHECK(map.insert(i, i * 3));
+  AUT_CHECK_EQ(map.size(), 1000);
+  AUT_CHECK_EQ(map.get(999).unwrap(), 2997);
+  AUT_CHECK(arena.bytes_used() > shards_only + 1000 * 2 * sizeof(u32));
+
+  return true;
+}
+
+AUT_BEGIN_TEST_LIST()
+AUT_ADD_TEST(test_basic_operations);
+AUT_ADD_TEST(test_parallel_disjoint_inserts);
+AUT_ADD_TEST(test_parallel_readers_and_writers);
+AUT_ADD_TEST(test_stateful_allocator);
+AUT_END_TEST_LIST()
+
+AUT_END_BLOCK()
+
+AUT_REGISTER_ENTRY(containers, concurrent_hash_map);
@@ -0,0 +1,140 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/utils/test.hpp>
+#include <auxid/containers/frozen_hash_map.hpp>
+#include <auxid/containers/hash_map.hpp>
+#include <auxid/std_wrappers/filesystem.hpp>
+
+using namespace au;
+
+AUT_BEGIN_BLOCK(containers, frozen_hash_map)
+
+using FrozenU32 = FrozenHashMap<u32, u32>;
+using FrozenStrings = FrozenHashMap<String, u64>;
+
+auto test_round_trip_in_memory() -> bool
+{
+  HashMap<u64, u32> map;
+  for (u64 i = 0; i < 2000; ++i)
+    map.insert(i * 7919, static_cast<u32>(i));
+
+  const Vec<u8> image = FrozenHashMap<u64, u32>::serialize(map);
+  auto frozen_res = FrozenHashMap<u64, u32>::from_memory(image);
+  AUT_CHECK(frozen_res.is_ok());
+
+  const auto &frozen = frozen_res.unwrap();
+  AUT_CHECK_EQ(frozen.size(), 2000);
+  for (u64 i = 0; i < 2000; ++i)
+  {
+    const u32 *v = frozen.find(i * 7919);
+    AUT_CHECK(v != nullptr);
+    AUT_CHECK_EQ(*v, static_cast<u32>(i));
+  }
+  AUT_CHECK_NOT(frozen.contains(1));
+
+  return true;
+}
+
+auto test_string_keys_through_file() -> bool
+{
+  HashMap<String, u64> map;
+  map.insert("content-type", 1);
+  map.insert("x-a-header-name-longer-than-the-sso-buffer", 2);
+  map.insert("", 3);
+
+  const filesystem::Path path = filesystem::temp_directory_path().unwrap() / "auxid_frozen_hash_map_test.bin";
+  AUT_CHECK(FrozenStrings::write(path.string().c_str(), map).is_ok());
+
+  {
+    auto frozen_res = FrozenStrings::open(path.string().c_str());
+    AUT_CHECK(frozen_res.is_ok());
+
+    const auto &frozen = frozen_res.unwrap();
+    AUT_CHECK_EQ(frozen.size(), 3);
+    AUT_CHECK_EQ(*frozen.find("content-type"), 1);
+    AUT_CHECK_EQ(*frozen.find(StringView("x-a-header-name-longer-than-the-sso-buffer")), 2);
+    AUT_CHECK_EQ(*frozen.find(""), 3);
+    AUT_CHECK_NOT(frozen.contains("content"));
+  }
+
+  AU_UNUSED(filesystem::remove(path));
+  return true;
+}
+
+auto test_rewrite_keeps_open_images_valid() -> bool
+{
+  HashMap<u32, u32> old_map;
+  for (u32 i = 0; i < 5000; ++i)
+    old_map.insert(i, i + 1);
+  HashMap<u32, u32> new_map;
+  new_map.insert(7, 70);
+
+  const filesystem::Path path = filesystem::temp_directory_path().unwrap() / "auxid_frozen_hash_map_rewrite.bin";
+  AUT_CHECK(FrozenU32::write(path.string().c_str(), old_map).is_ok());
+
+  {
+    auto old_res = FrozenU32::open(path.string().c_str());
+    AUT_CHECK(old_res.is_ok());
+    const auto &old_frozen = old_res.unwrap();
+
+    // A smaller image replaces the file while the old one is still mapped; truncating in
+    // place would fault on the lookups below.
+    AUT_CHECK(FrozenU32::write(path.string().c_str(), new_map).is_ok());
+    AUT_CHECK_EQ(old_frozen.size(), 5000);
+    AUT_CHECK_EQ(*old_frozen.find(4999), 5000);
+
+    auto new_res = FrozenU32::open(path.string().c_str());
+    AUT_CHECK(new_res.is_ok());
+    AUT_CHECK_EQ(new_res.unwrap().size(), 1);
+    AUT_CHECK_EQ(*new_res.unwrap().find(7), 70);
+  }
+
+  AU_UNUSED(filesystem::remove(path));
+  return true;
+}
+
+auto test_rejects_bad_images() -> bool
+{
+  HashMap<u32, u32> map;
+  map.insert(1, 2);
+  Vec<u8> image = FrozenU32::serialize(map);
+
+  // Same key kind, different value layout.
+  auto wrong_layout = FrozenHashMap<u32, u64>::from_memory(image);
+  AUT_CHECK(wrong_layout.is_err());
+
+  const Span<const u8> truncated(image.data(), image.size() - 1);
+  AUT_CHECK(FrozenU32::from_memory(truncated).is_err());
+
+  image[0] ^= 0xFF;
+  AUT_CHECK(FrozenU32::from_memory(image).is_err());
+
+  AUT_CHECK(FrozenU32::open("/nonexistent/auxid/frozen.bin").is_err());
+
+  return true;
+}
+
+AUT_BEGIN_TEST_LIST()
+AUT_ADD_TEST(test_round_trip_in_memory);
+AUT_ADD_TEST(test_string_keys_through_file);
+AUT_ADD_TEST(test_rewrite_keeps_open_images_valid);
+AUT_ADD_TEST(test_rejects_bad_images);
+AUT_END_TEST_LIST()
+
+AUT_END_BLOCK()
+
+AUT_REGISTER_ENTRY(containers, frozen_hash_map);
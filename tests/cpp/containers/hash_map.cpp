@@ -16,6 +16,7 @@
 #include <auxid/utils/test.hpp>
 #include <auxid/containers/hash_map.hpp>
 #include <auxid/containers/string.hpp>
+#include <auxid/memory/arena.hpp>
 
 using namespace au;
 
@@ -64,10 +65,181 @@ auto test_operator_brackets() -> bool
   return true;
 }
 
+auto test_grow_and_find_many() -> bool
+{
+  HashMap<u64, u64> map;
+
+  for (u64 i = 0; i < 10000; ++i)
+    AUT_CHECK(map.insert(i * 7919, i));
+
+  AUT_CHECK_EQ(map.size(), 10000);
+
+  for (u64 i = 0; i < 10000; ++i)
+  {
+    u64 *val = map.find(i * 7919);
+    AUT_CHECK_NOT(val == nullptr);
+    AUT_CHECK_EQ(*val, i);
+  }
+
+  AUT_CHECK_NOT(map.contains(1));
+  AUT_CHECK_NOT(map.contains(7919 * 10000));
+
+  return true;
+}
+
+auto test_erase_reinsert_cycles() -> bool
+{
+  HashMap<u64, u64> map;
+
+  for (u64 round = 0; round < 8; ++round)
+  {
+    for (u64 i = 0; i < 2000; ++i)
+      map[i + round * 1000] = i;
+
+    for (u64 i = 0; i < 2000; i += 2)
+      AUT_CHECK(map.erase(i + round * 1000));
+
+    for (u64 i = 1; i < 2000; i += 2)
+    {
+      u64 *val = map.find(i + round * 1000);
+      AUT_CHECK_NOT(val == nullptr);
+      AUT_CHECK_EQ(*val, i);
+    }
+
+    for (u64 i = 0; i < 2000; i += 2)
+      AUT_CHECK_NOT(map.contains(i + round * 1000));
+
+    map.clear();
+    AUT_CHECK(map.empty());
+  }
+
+  return true;
+}
+
+auto test_cached_hashes() -> bool
+{
+  CachedHashMap<String, u32> map;
+
+  for (u32 i = 0; i < 3000; ++i)
+    AUT_CHECK(map.insert(String::format("key_with_a_long_prefix_%u", i), i));
+
+  for (u32 i = 0; i < 3000; i += 3)
+    AUT_CHECK(map.erase(String::format("key_with_a_long_prefix_%u", i)));
+
+  AUT_CHECK_EQ(map.size(), 2000);
+
+  for (u32 i = 0; i < 3000; ++i)
+  {
+    u32 *val = map.find(String::format("key_with_a_long_prefix_%u", i));
+    if (i % 3 == 0)
+    {
+      AUT_CHECK(val == nullptr);
+    }
+    else
+    {
+      AUT_CHECK_NOT(val == nullptr);
+      AUT_CHECK_EQ(*val, i);
+    }
+  }
+
+  return true;
+}
+
+auto test_transparent_lookup() -> bool
+{
+  HashMap<String, i32> map;
+  map.insert("content-length-and-then-some", 1);
+  map.insert("host", 2);
+
+  // Keys sliced straight out of a request buffer; the first is past the SSO capacity.
+  const char *request = "content-length-and-then-some: 42\r\nhost: example\r\n";
+  const StringView long_key = StringView(request).substr(0, 28);
+  const StringView short_key = StringView(request).substr(34, 4);
+
+  AUT_CHECK(map.contains(long_key));
+  AUT_CHECK_EQ(*map.find(short_key), 2);
+  AUT_CHECK_EQ(*map.find("host"), 2);
+  AUT_CHECK(map.find(StringView("hos")) == nullptr);
+
+  map[short_key] = 20;
+  AUT_CHECK_EQ(map.size(), 2);
+  map[StringView("accept")] = 3;
+  AUT_CHECK_EQ(map.size(), 3);
+  AUT_CHECK_EQ(map[String("accept")], 3);
+
+  AUT_CHECK(map.erase(long_key));
+  AUT_CHECK_NOT(map.contains("content-length-and-then-some"));
+
+  return true;
+}
+
+auto test_bulk_build() -> bool
+{
+  Vec<Pair<u32, u32>> items;
+  for (u32 i = 0; i < 3000; ++i)
+    items.push({i, i * 2});
+  // Duplicates of earlier keys, both within and across batches; first occurrence wins.
+  items.push({5, 999});
+  items.push({2999, 999});
+
+  auto map = HashMap<u32, u32>::build(items);
+  AUT_CHECK_EQ(map.size(), 3000);
+  AUT_CHECK_EQ(*map.find(5), 10);
+  AUT_CHECK_EQ(*map.find(2999), 5998);
+
+  Vec<Pair<u32, u32>> more;
+  for (u32 i = 2500; i < 4000; ++i)
+    more.push({i, 0});
+  AUT_CHECK_EQ(map.insert_many(more), 1000);
+  AUT_CHECK_EQ(map.size(), 4000);
+  AUT_CHECK_EQ(*map.find(2500), 5000);
+  AUT_CHECK_EQ(*map.find(3999), 0);
+
+  items.pop();
+  items.pop();
+  auto unique = CachedHashMap<u32, u32>::from_unique(items);
+  AUT_CHECK_EQ(unique.size(), 3000);
+  for (u32 i = 0; i < 3000; ++i)
+    AUT_CHECK_EQ(*unique.find(i), i * 2);
+  AUT_CHECK(unique.find(3000) == nullptr);
+
+  return true;
+}
+
+auto test_bulk_build_with_allocator() -> bool
+{
+  using Arena = memory::ChainedArenaAllocator<>;
+  using ArenaMap = containers::HashMap<u32, u32, containers::Hash<u32>, containers::EqualTo<u32>,
+                                       memory::ArenaRef<Arena>>;
+
+  Vec<Pair<u32, u32>> items;
+  for (u32 i = 0; i < 1000; ++i)
+    items.push({i, i + 1});
+
+  Arena arena(1 << 16);
+  auto built = ArenaMap::build(items, memory::ArenaRef<Arena>(arena));
+  const usize after_build = arena.bytes_used();
+  AUT_CHECK(after_build >= 1000 * sizeof(Pair<u32, u32>));
+  AUT_CHECK_EQ(*built.find(999), 1000);
+
+  auto unique = ArenaMap::from_unique(items, memory::ArenaRef<Arena>(arena));
+  AUT_CHECK(arena.bytes_used() >= after_build + 1000 * sizeof(Pair<u32, u32>));
+  AUT_CHECK_EQ(unique.size(), 1000);
+  AUT_CHECK_EQ(*unique.find(0), 1);
+
+  return true;
+}
+
 AUT_BEGIN_TEST_LIST()
 AUT_ADD_TEST(test_insert_and_find);
 AUT_ADD_TEST(test_erase);
 AUT_ADD_TEST(test_operator_brackets);
+AUT_ADD_TEST(test_grow_and_find_many);
+AUT_ADD_TEST(test_erase_reinsert_cycles);
+AUT_ADD_TEST(test_cached_hashes);
+AUT_ADD_TEST(test_transparent_lookup);
+AUT_ADD_TEST(test_bulk_build);
+AUT_ADD_TEST(test_bulk_build_with_allocator);
 AUT_END_TEST_LIST()
 
 AUT_END_BLOCK()
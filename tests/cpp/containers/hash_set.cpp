@@ -58,9 +58,60 @@ auto test_erase_and_clear() -> bool
   return true;
 }
 
+template<typename SetT> auto check_erase_all_and_refill() -> bool
+{
+  SetT set;
+
+  for (u32 i = 0; i < 5000; ++i)
+    AUT_CHECK(set.insert(i));
+
+  for (u32 i = 0; i < 5000; ++i)
+    AUT_CHECK(set.erase(i));
+
+  AUT_CHECK(set.empty());
+
+  for (u32 i = 5000; i < 10000; ++i)
+    AUT_CHECK(set.insert(i));
+
+  for (u32 i = 0; i < 10000; ++i)
+    AUT_CHECK_EQ(set.contains(i), i >= 5000);
+
+  return true;
+}
+
+auto test_erase_all_and_refill() -> bool
+{
+  return check_erase_all_and_refill<HashSet<u32>>();
+}
+
+auto test_cached_erase_all_and_refill() -> bool
+{
+  return check_erase_all_and_refill<CachedHashSet<u32>>();
+}
+
+auto test_transparent_lookup() -> bool
+{
+  CachedHashSet<String> set;
+  set.insert("a-key-that-does-not-fit-in-sso");
+  set.insert("short");
+
+  const StringView line = "short,a-key-that-does-not-fit-in-sso";
+  AUT_CHECK(set.contains(line.substr(0, 5)));
+  AUT_CHECK(set.contains(line.substr(6)));
+  AUT_CHECK_NOT(set.contains(line.substr(0, 4)));
+
+  AUT_CHECK(set.erase(line.substr(6)));
+  AUT_CHECK_EQ(set.size(), 1);
+
+  return true;
+}
+
 AUT_BEGIN_TEST_LIST()
 AUT_ADD_TEST(test_insert_and_contains);
 AUT_ADD_TEST(test_erase_and_clear);
+AUT_ADD_TEST(test_erase_all_and_refill);
+AUT_ADD_TEST(test_cached_erase_all_and_refill);
+AUT_ADD_TEST(test_transparent_lookup);
 AUT_END_TEST_LIST()
 
 AUT_END_BLOCK()
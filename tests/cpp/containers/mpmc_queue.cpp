@@ -0,0 +1,183 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/utils/test.hpp>
+#include <auxid/containers/mpmc_queue.hpp>
+#include <auxid/containers/string.hpp>
+#include <auxid/containers/vec.hpp>
+#include <auxid/thread/thread.hpp>
+
+using namespace au;
+
+AUT_BEGIN_BLOCK(containers, mpmc_queue)
+
+auto test_push_pop_until_full() -> bool
+{
+  MpmcQueue<u32, 4> queue;
+  for (u32 i = 0; i < 4; ++i)
+    AUT_CHECK(queue.try_push(i));
+  AUT_CHECK_NOT(queue.try_push(99));
+  AUT_CHECK_EQ(queue.size_approx(), 4);
+
+  u32 value = 0;
+  for (u32 i = 0; i < 4; ++i)
+  {
+    AUT_CHECK(queue.try_pop(value));
+    AUT_CHECK_EQ(value, i);
+  }
+  AUT_CHECK_NOT(queue.try_pop(value));
+
+  // Wraps around the ring.
+  AUT_CHECK(queue.try_push(7));
+  AUT_CHECK(queue.try_pop(value));
+  AUT_CHECK_EQ(value, 7);
+
+  return true;
+}
+
+auto test_bulk() -> bool
+{
+  MpmcQueue<u64, 8> queue;
+  u64 in[12];
+  for (u64 i = 0; i < 12; ++i)
+    in[i] = i * 10;
+
+  AUT_CHECK_EQ(queue.try_push_bulk(Span<u64>(in, 12)), 8);
+  AUT_CHECK_EQ(queue.try_push_bulk(Span<u64>(in + 8, 4)), 0);
+
+  u64 out[5];
+  AUT_CHECK_EQ(queue.try_pop_bulk(Span<u64>(out, 5)), 5);
+  AUT_CHECK_EQ(out[4], 40);
+  AUT_CHECK_EQ(queue.try_push_bulk(Span<u64>(in + 8, 4)), 4);
+
+  u64 rest[16];
+  AUT_CHECK_EQ(queue.try_pop_bulk(Span<u64>(rest, 16)), 7);
+  AUT_CHECK_EQ(rest[0], 50);
+  AUT_CHECK_EQ(rest[6], 110);
+
+  return true;
+}
+
+auto test_bulk_empty_span() -> bool
+{
+  u64 buf[1] = {5};
+
+  MpmcQueue<u64, 8> queue;
+  AUT_CHECK(queue.try_push(1));
+  AUT_CHECK_EQ(queue.try_push_bulk(Span<u64>(buf, usize(0))), 0);
+  AUT_CHECK_EQ(queue.try_pop_bulk(Span<u64>(buf, usize(0))), 0);
+  AUT_CHECK_EQ(queue.size_approx(), 1);
+
+  auto dynamic = DynamicMpmcQueue<u64>::create(8).unwrap();
+  AUT_CHECK(dynamic.try_push(1));
+  AUT_CHECK_EQ(dynamic.try_push_bulk(Span<u64>(buf, usize(0))), 0);
+  AUT_CHECK_EQ(dynamic.try_pop_bulk(Span<u64>(buf, usize(0))), 0);
+  AUT_CHECK_EQ(dynamic.size_approx(), 1);
+
+  return true;
+}
+
+auto test_dynamic_non_trivial() -> bool
+{
+  auto queue_res = DynamicMpmcQueue<String>::create(5);
+  AUT_CHECK(queue_res.is_ok());
+  auto queue = std::move(queue_res.unwrap());
+  AUT_CHECK_EQ(queue.capacity(), 8);
+
+  AUT_CHECK(queue.try_push(String("a message long enough to be on the heap")));
+  AUT_CHECK(queue.try_push(String("second")));
+
+  String out;
+  AUT_CHECK(queue.try_pop(out));
+  AUT_CHECK(out == "a message long enough to be on the heap");
+
+  // The remaining element is destroyed with the moved-to queue.
+  auto moved = std::move(queue);
+  AUT_CHECK_EQ(moved.size_approx(), 1);
+
+  AUT_CHECK_NOT(DynamicMpmcQueue<String>::create(0).is_ok());
+
+  return true;
+}
+
+auto test_concurrent_fan_in_fan_out() -> bool
+{
+  constexpr u32 PRODUCERS = 4;
+  constexpr u32 CONSUMERS = 4;
+  constexpr u64 PER_PRODUCER = 20000;
+
+  auto queue = DynamicMpmcQueue<u64>::create(64).unwrap();
+  std::atomic<u64> consumed_sum{0};
+  std::atomic<u64> consumed_count{0};
+
+  const auto producer = [&queue](u64 p) {
+    u64 batch[4];
+    u64 next = 0;
+    while (next < PER_PRODUCER)
+    {
+      // Alternate single and batched pushes.
+      if (next % 2 == 0)
+      {
+        if (queue.try_push(p * PER_PRODUCER + next + 1))
+          next++;
+        continue;
+      }
+      usize count = 0;
+      for (; count < 4 && next + count < PER_PRODUCER; ++count)
+        batch[count] = p * PER_PRODUCER + next + count + 1;
+      next += queue.try_push_bulk(Span<u64>(batch, count));
+    }
+  };
+
+  const auto consumer = [&]() {
+    u64 batch[8];
+    while (consumed_count.load(std::memory_order_relaxed) < PRODUCERS * PER_PRODUCER)
+    {
+      const usize n = queue.try_pop_bulk(Span<u64>(batch, 8));
+      u64 sum = 0;
+      for (usize i = 0; i < n; ++i)
+        sum += batch[i];
+      consumed_sum.fetch_add(sum, std::memory_order_relaxed);
+      consumed_count.fetch_add(n, std::memory_order_relaxed);
+    }
+  };
+
+  Vec<Thread> threads;
+  for (u64 p = 0; p < PRODUCERS; ++p)
+    threads.push(std::move(Thread::create(producer, p).unwrap()));
+  for (u32 c = 0; c < CONSUMERS; ++c)
+    threads.push(std::move(Thread::create(consumer).unwrap()));
+  for (Thread &t : threads)
+    t.join();
+
+  const u64 total = PRODUCERS * PER_PRODUCER;
+  AUT_CHECK_EQ(consumed_count.load(), total);
+  AUT_CHECK_EQ(consumed_sum.load(), total * (total + 1) / 2);
+
+  return true;
+}
+
+AUT_BEGIN_TEST_LIST()
+AUT_ADD_TEST(test_push_pop_until_full);
+AUT_ADD_TEST(test_bulk);
+AUT_ADD_TEST(test_bulk_empty_span);
+AUT_ADD_TEST(test_dynamic_non_trivial);
+AUT_ADD_TEST(test_concurrent_fan_in_fan_out);
+AUT_END_TEST_LIST()
+
+AUT_END_BLOCK()
+
+AUT_REGISTER_ENTRY(containers, mpmc_queue);
@@ -0,0 +1,153 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/utils/test.hpp>
+#include <auxid/containers/ring_buffer.hpp>
+
+using namespace au;
+
+AUT_BEGIN_BLOCK(containers, ring_buffer)
+
+auto test_push_pop() -> bool
+{
+  auto ring = containers::DynamicRingBuffer::create(1024).unwrap();
+
+  const u8 payload[3] = {1, 2, 3};
+  AUT_CHECK(ring.push(7, Span<const u8>(payload, 3)).is_ok());
+
+  containers::PacketHeader header;
+  u8 out[16];
+  AUT_CHECK_EQ(ring.pop(header, Span<u8>(out, 16)).unwrap(), sizeof(containers::PacketHeader) + 3);
+  AUT_CHECK_EQ(header.id, 7);
+  AUT_CHECK_EQ(header.payload_size, 3);
+  AUT_CHECK_EQ(out[2], 3);
+  AUT_CHECK_EQ(ring.pop(header, Span<u8>(out, 16)).unwrap(), 0);
+
+  return true;
+}
+
+auto test_reserve_commit_peek_release() -> bool
+{
+  auto ring = containers::DynamicRingBuffer::create(1024).unwrap();
+  AUT_CHECK(ring.peek().is_none());
+  AUT_CHECK_NOT(ring.release().is_ok());
+
+  // Reserve more than needed and commit only what was written.
+  auto span = ring.reserve(9, 64).unwrap();
+  AUT_CHECK_EQ(span.size(), 64);
+  for (u8 i = 0; i < 10; ++i)
+    span[i] = i;
+  AUT_CHECK(ring.peek().is_none());
+  AUT_CHECK_NOT(ring.commit(65).is_ok());
+  AUT_CHECK(ring.commit(10).is_ok());
+
+  auto packet = ring.peek();
+  AUT_CHECK(packet.is_some());
+  AUT_CHECK_EQ(packet->header.id, 9);
+  AUT_CHECK_EQ(packet->header.payload_size, 10);
+  AUT_CHECK_EQ(packet->payload.size(), 10);
+  AUT_CHECK_EQ(packet->payload[9], 9);
+
+  // Mixes with the copying API.
+  const u8 payload[2] = {42, 43};
+  AUT_CHECK(ring.push(1, Span<const u8>(payload, 2)).is_ok());
+
+  AUT_CHECK(ring.release().is_ok());
+  packet = ring.peek();
+  AUT_CHECK(packet.is_some());
+  AUT_CHECK_EQ(packet->header.id, 1);
+  AUT_CHECK_EQ(packet->payload[1], 43);
+  AUT_CHECK(ring.release().is_ok());
+  AUT_CHECK(ring.peek().is_none());
+
+  return true;
+}
+
+auto test_reserve_limits() -> bool
+{
+  auto ring = containers::DynamicRingBuffer::create(1024).unwrap();
+  // Header-only packets are fine.
+  AUT_CHECK(ring.reserve(0, 0).is_ok());
+  AUT_CHECK(ring.commit(0).is_ok());
+  AUT_CHECK(ring.peek().is_some());
+  AUT_CHECK(ring.release().is_ok());
+
+  AUT_CHECK_NOT(ring.reserve(0, 70000).is_ok());
+  AUT_CHECK_NOT(ring.reserve(0, 1u << 20).is_ok());
+
+  return true;
+}
+
+auto test_commit_requires_reserve() -> bool
+{
+  auto ring = containers::DynamicRingBuffer::create(1024).unwrap();
+  AUT_CHECK_NOT(ring.commit(0).is_ok());
+  AUT_CHECK(ring.peek().is_none());
+
+  auto span = ring.reserve(3, 16).unwrap();
+  span[0] = 7;
+  const u8 payload[1] = {1};
+  AUT_CHECK_NOT(ring.push(1, Span<const u8>(payload, 1)).is_ok());
+  AUT_CHECK(ring.commit(1).is_ok());
+
+  // The bytes of the packet just published must not be committed a second time.
+  AUT_CHECK_NOT(ring.commit(1).is_ok());
+
+  auto packet = ring.peek();
+  AUT_CHECK(packet.is_some());
+  AUT_CHECK_EQ(packet->header.id, 3);
+  AUT_CHECK_EQ(packet->payload[0], 7);
+  AUT_CHECK(ring.release().is_ok());
+  AUT_CHECK(ring.peek().is_none());
+
+  return true;
+}
+
+auto test_payload_is_contiguous_across_wrap() -> bool
+{
+  auto ring = containers::DynamicRingBuffer::create(1024).unwrap();
+
+  // 100-byte payloads do not divide the capacity, so packets keep landing across the end
+  // of the buffer; the mirrored mapping must still hand out one contiguous span.
+  for (u32 round = 0; round < 500; ++round)
+  {
+    auto span = ring.reserve(static_cast<u16>(round), 100).unwrap();
+    for (u32 i = 0; i < 100; ++i)
+      span[i] = static_cast<u8>(round + i);
+    AUT_CHECK(ring.commit(100).is_ok());
+
+    auto packet = ring.peek();
+    AUT_CHECK(packet.is_some());
+    AUT_CHECK_EQ(packet->header.id, static_cast<u16>(round));
+    for (u32 i = 0; i < 100; ++i)
+      AUT_CHECK_EQ(packet->payload[i], static_cast<u8>(round + i));
+    AUT_CHECK(ring.release().is_ok());
+  }
+
+  return true;
+}
+
+AUT_BEGIN_TEST_LIST()
+AUT_ADD_TEST(test_push_pop);
+AUT_ADD_TEST(test_reserve_commit_peek_release);
+AUT_ADD_TEST(test_reserve_limits);
+AUT_ADD_TEST(test_commit_requires_reserve);
+AUT_ADD_TEST(test_payload_is_contiguous_across_wrap);
+AUT_END_TEST_LIST()
+
+AUT_END_BLOCK()
+
+AUT_REGISTER_ENTRY(containers, ring_buffer);
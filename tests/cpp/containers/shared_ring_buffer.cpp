@@ -0,0 +1,174 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/utils/test.hpp>
+#include <auxid/containers/shared_ring_buffer.hpp>
+#include <auxid/containers/static_string.hpp>
+
+#if defined(_WIN32)
+#  include <windows.h>
+#else
+#  include <signal.h>
+#  include <sys/wait.h>
+#  include <unistd.h>
+#endif
+
+using namespace au;
+
+AUT_BEGIN_BLOCK(containers, shared_ring_buffer)
+
+// Unique per test run, so parallel runs and leftovers from a crash do not collide.
+static auto ring_name(const char *tag) -> StaticString<64>
+{
+  StaticString<64> name;
+#if defined(_WIN32)
+  name.append_format("Local\\auxid_test_%s_%u", tag, static_cast<u32>(GetCurrentProcessId()));
+#else
+  name.append_format("/auxid_test_%s_%d", tag, static_cast<int>(getpid()));
+#endif
+  return name;
+}
+
+auto test_create_and_open_by_name() -> bool
+{
+  const auto name = ring_name("named");
+  auto producer = containers::SharedRingBuffer::create(name.c_str(), 4096).unwrap();
+  AUT_CHECK_NOT(containers::SharedRingBuffer::create(name.c_str(), 4096).is_ok());
+
+  // A second, independent mapping of the same object, as another process would have.
+  auto consumer = std::move(containers::SharedRingBuffer::open(name.c_str()).unwrap());
+  AUT_CHECK_EQ(consumer.capacity(), producer.capacity());
+
+  const u8 payload[3] = {1, 2, 3};
+  AUT_CHECK(producer.push(5, Span<const u8>(payload, 3)).is_ok());
+
+  // Packets that wrap the end of the data are contiguous in both mappings.
+  for (u32 round = 0; round < 200; ++round)
+  {
+    auto span = producer.reserve(static_cast<u16>(round), 100).unwrap();
+    span[0] = static_cast<u8>(round);
+    span[99] = static_cast<u8>(round + 1);
+    AUT_CHECK(producer.commit(100).is_ok());
+
+    if (round == 0)
+    {
+      auto first = consumer.peek();
+      AUT_CHECK(first.is_some());
+      AUT_CHECK_EQ(first->header.id, 5);
+      AUT_CHECK_EQ(first->payload[2], 3);
+      AUT_CHECK(consumer.release().is_ok());
+    }
+
+    auto packet = consumer.peek();
+    AUT_CHECK(packet.is_some());
+    AUT_CHECK_EQ(packet->header.id, static_cast<u16>(round));
+    AUT_CHECK_EQ(packet->payload[0], static_cast<u8>(round));
+    AUT_CHECK_EQ(packet->payload[99], static_cast<u8>(round + 1));
+    AUT_CHECK(consumer.release().is_ok());
+  }
+  AUT_CHECK(consumer.peek().is_none());
+
+  return true;
+}
+
+auto test_open_missing() -> bool
+{
+  AUT_CHECK_NOT(containers::SharedRingBuffer::open(ring_name("missing").c_str()).is_ok());
+  return true;
+}
+
+auto test_creator_unlinks_name() -> bool
+{
+  const auto name = ring_name("unlink");
+  {
+    auto ring = containers::SharedRingBuffer::create(name.c_str(), 4096).unwrap();
+    auto moved = std::move(ring);
+    AUT_CHECK(containers::SharedRingBuffer::open(name.c_str()).is_ok());
+  }
+  AUT_CHECK_NOT(containers::SharedRingBuffer::open(name.c_str()).is_ok());
+  return true;
+}
+
+#if !defined(_WIN32)
+auto test_cross_process_by_fd() -> bool
+{
+  constexpr u32 PACKETS = 10000;
+  auto ring = std::move(containers::SharedRingBuffer::create_anonymous(4096).unwrap());
+
+  const pid_t child = fork();
+  AUT_CHECK(child >= 0);
+  if (child == 0)
+  {
+    // The child attaches through the inherited fd and produces; it never returns here.
+    auto producer = containers::SharedRingBuffer::open_fd(ring.fd());
+    if (!producer.is_ok())
+      _exit(1);
+    for (u32 i = 0; i < PACKETS;)
+    {
+      auto span = producer.unwrap().reserve(1, sizeof(u32));
+      if (!span.is_ok())
+      {
+        sched_yield();
+        continue;
+      }
+      std::memcpy(span.unwrap().data(), &i, sizeof(u32));
+      (void) producer.unwrap().commit(sizeof(u32));
+      i++;
+    }
+    _exit(0);
+  }
+
+  u32 expected = 0;
+  while (expected < PACKETS)
+  {
+    auto packet = ring.peek();
+    if (packet.is_none())
+    {
+      sched_yield();
+      continue;
+    }
+    u32 value;
+    std::memcpy(&value, packet->payload.data(), sizeof(u32));
+    if (value != expected)
+      break;
+    AUT_CHECK(ring.release().is_ok());
+    expected++;
+  }
+
+  // A mismatch leaves the child blocked on a full ring.
+  if (expected != PACKETS)
+    kill(child, SIGKILL);
+  int status = 0;
+  waitpid(child, &status, 0);
+  AUT_CHECK_EQ(expected, PACKETS);
+  AUT_CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+  return true;
+}
+#endif
+
+AUT_BEGIN_TEST_LIST()
+AUT_ADD_TEST(test_create_and_open_by_name);
+AUT_ADD_TEST(test_open_missing);
+AUT_ADD_TEST(test_creator_unlinks_name);
+#if !defined(_WIN32)
+AUT_ADD_TEST(test_cross_process_by_fd);
+#endif
+AUT_END_TEST_LIST()
+
+AUT_END_BLOCK()
+
+AUT_REGISTER_ENTRY(containers, shared_ring_buffer);
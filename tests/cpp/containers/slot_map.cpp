@@ -0,0 +1,97 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/utils/test.hpp>
+#include <auxid/containers/slot_map.hpp>
+#include <auxid/containers/string.hpp>
+
+using namespace au;
+
+AUT_BEGIN_BLOCK(containers, slot_map)
+
+auto test_insert_get_erase() -> bool
+{
+  SlotMap<u64> map;
+  const SlotHandle a = map.insert(10);
+  const SlotHandle b = map.insert(20);
+  const SlotHandle c = map.insert(30);
+  AUT_CHECK_EQ(map.size(), 3);
+  AUT_CHECK_EQ(*map.get(b), 20);
+
+  AUT_CHECK(map.erase(a));
+  AUT_CHECK_NOT(map.erase(a));
+  AUT_CHECK(map.get(a) == nullptr);
+  AUT_CHECK_NOT(map.contains(a));
+
+  // The survivors are still reachable after the last element moved into the hole.
+  AUT_CHECK_EQ(*map.get(b), 20);
+  AUT_CHECK_EQ(*map.get(c), 30);
+  AUT_CHECK_EQ(map.size(), 2);
+
+  AUT_CHECK(map.get(SlotHandle{}) == nullptr);
+
+  return true;
+}
+
+auto test_stale_handle_after_reuse() -> bool
+{
+  SlotMap<String> map;
+  const SlotHandle old_handle = map.insert(String("old"));
+  map.erase(old_handle);
+
+  const SlotHandle new_handle = map.emplace("new");
+  AUT_CHECK_EQ(new_handle.index, old_handle.index);
+  AUT_CHECK_NOT(new_handle == old_handle);
+  AUT_CHECK(map.get(old_handle) == nullptr);
+  AUT_CHECK(*map.get(new_handle) == "new");
+
+  return true;
+}
+
+auto test_dense_iteration() -> bool
+{
+  SlotMap<u32> map;
+  Vec<SlotHandle> handles;
+  for (u32 i = 0; i < 100; ++i)
+    handles.push(map.insert(i));
+  for (u32 i = 0; i < 100; i += 2)
+    map.erase(handles[i]);
+
+  u32 sum = 0;
+  for (const u32 v : map)
+    sum += v;
+  AUT_CHECK_EQ(sum, 2500);
+  AUT_CHECK_EQ(map.values().size(), 50);
+
+  for (usize i = 0; i < map.size(); ++i)
+    AUT_CHECK_EQ(*map.get(map.handle_at(i)), map.values()[i]);
+
+  map.clear();
+  AUT_CHECK(map.empty());
+  AUT_CHECK(map.get(handles[1]) == nullptr);
+
+  return true;
+}
+
+AUT_BEGIN_TEST_LIST()
+AUT_ADD_TEST(test_insert_get_erase);
+AUT_ADD_TEST(test_stale_handle_after_reuse);
+AUT_ADD_TEST(test_dense_iteration);
+AUT_END_TEST_LIST()
+
+AUT_END_BLOCK()
+
+AUT_REGISTER_ENTRY(containers, slot_map);
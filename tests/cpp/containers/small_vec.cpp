@@ -0,0 +1,148 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/utils/test.hpp>
+#include <auxid/containers/small_vec.hpp>
+#include <auxid/containers/string.hpp>
+#include <auxid/memory/arena.hpp>
+
+using namespace au;
+
+AUT_BEGIN_BLOCK(containers, small_vec)
+
+auto test_inline_then_spill() -> bool
+{
+  SmallVec<i32, 4> v;
+  AUT_CHECK(v.is_inline());
+  AUT_CHECK_EQ(v.capacity(), 4);
+
+  for (i32 i = 0; i < 4; ++i)
+    v.push(i);
+  AUT_CHECK(v.is_inline());
+
+  v.push(4);
+  AUT_CHECK_NOT(v.is_inline());
+  AUT_CHECK_EQ(v.size(), 5);
+  for (i32 i = 0; i < 5; ++i)
+    AUT_CHECK_EQ(v[i], i);
+
+  // Once spilled, it stays on the heap like VecT.
+  v.clear();
+  AUT_CHECK_NOT(v.is_inline());
+
+  return true;
+}
+
+auto test_non_trivial_elements() -> bool
+{
+  SmallVec<String, 2> v = {"a string long enough to live on the heap", "short"};
+  AUT_CHECK(v.is_inline());
+
+  v.emplace_back("third");
+  AUT_CHECK_NOT(v.is_inline());
+  AUT_CHECK_EQ(v[0], "a string long enough to live on the heap");
+  AUT_CHECK_EQ(v[2], "third");
+
+  SmallVec<String, 2> copy = v;
+  AUT_CHECK_EQ(copy.size(), 3);
+  AUT_CHECK_EQ(copy[1], "short");
+
+  v.pop();
+  v.pop();
+  AUT_CHECK_EQ(v.size(), 1);
+  AUT_CHECK_EQ(v.back(), "a string long enough to live on the heap");
+
+  return true;
+}
+
+auto test_moves() -> bool
+{
+  SmallVec<String, 4> small = {"x", "y"};
+  SmallVec<String, 4> moved_inline = std::move(small);
+  AUT_CHECK(moved_inline.is_inline());
+  AUT_CHECK_EQ(moved_inline.size(), 2);
+  AUT_CHECK_EQ(moved_inline[1], "y");
+  AUT_CHECK(small.empty());
+
+  SmallVec<String, 4> big;
+  for (u32 i = 0; i < 10; ++i)
+    big.push(String("element"));
+  const String *heap_data = big.data();
+  SmallVec<String, 4> moved_heap = std::move(big);
+  AUT_CHECK_EQ(moved_heap.data(), heap_data);
+  AUT_CHECK(big.is_inline());
+  AUT_CHECK(big.empty());
+
+  moved_heap = std::move(moved_inline);
+  AUT_CHECK(moved_heap.is_inline());
+  AUT_CHECK_EQ(moved_heap.size(), 2);
+  AUT_CHECK_EQ(moved_heap[0], "x");
+
+  // Both sides of a moved-from vector stay usable.
+  big.push(String("again"));
+  AUT_CHECK_EQ(big.size(), 1);
+
+  return true;
+}
+
+auto test_span_and_iteration() -> bool
+{
+  SmallVec<u32, 8> v;
+  v.resize(6, 3);
+
+  Span<const u32> span = v;
+  AUT_CHECK_EQ(span.size(), 6);
+  AUT_CHECK_EQ(span.data(), v.data());
+
+  u32 sum = 0;
+  for (const u32 x : v)
+    sum += x;
+  AUT_CHECK_EQ(sum, 18);
+  AUT_CHECK_EQ(*v.rbegin(), 3);
+
+  return true;
+}
+
+auto test_custom_allocator_spill() -> bool
+{
+  using Arena = memory::ChainedArenaAllocator<>;
+  using ArenaSmallVec = containers::SmallVecT<u64, 2, u32, memory::ArenaRef<Arena>>;
+
+  Arena arena(4096);
+  ArenaSmallVec v{memory::ArenaRef<Arena>(arena)};
+  v.push(1);
+  v.push(2);
+  AUT_CHECK_EQ(arena.bytes_used(), 0);
+
+  v.push(3);
+  AUT_CHECK_NOT(v.is_inline());
+  AUT_CHECK(arena.bytes_used() >= 3 * sizeof(u64));
+  AUT_CHECK_EQ(v[2], 3);
+
+  return true;
+}
+
+AUT_BEGIN_TEST_LIST()
+AUT_ADD_TEST(test_inline_then_spill);
+AUT_ADD_TEST(test_non_trivial_elements);
+AUT_ADD_TEST(test_moves);
+AUT_ADD_TEST(test_span_and_iteration);
+AUT_ADD_TEST(test_custom_allocator_spill);
+AUT_END_TEST_LIST()
+
+AUT_END_BLOCK()
+
+AUT_REGISTER_ENTRY(containers, small_vec);
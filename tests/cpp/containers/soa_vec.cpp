@@ -0,0 +1,130 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/utils/test.hpp>
+#include <auxid/containers/soa_vec.hpp>
+#include <auxid/containers/string.hpp>
+#include <auxid/memory/arena.hpp>
+
+using namespace au;
+
+AUT_BEGIN_BLOCK(containers, soa_vec)
+
+auto test_push_and_columns() -> bool
+{
+  SoaVec<f32, u8, u64> soa;
+  for (u32 i = 0; i < 100; ++i)
+    soa.push(static_cast<f32>(i), static_cast<u8>(i), u64(i) * 1000);
+
+  AUT_CHECK_EQ(soa.size(), 100);
+  AUT_CHECK_EQ(soa.get<2>(42), 42000);
+
+  // Each column is contiguous and starts on its own cache line.
+  Span<u8> bytes = soa.column<1>();
+  AUT_CHECK_EQ(bytes.size(), 100);
+  AUT_CHECK_EQ(bytes[99], 99);
+  AUT_CHECK_EQ(reinterpret_cast<uintptr_t>(bytes.data()) % 64, 0);
+  AUT_CHECK_EQ(reinterpret_cast<uintptr_t>(soa.column<2>().data()) % 64, 0);
+
+  auto [x, tag, id] = soa[7];
+  AUT_CHECK_EQ(x, 7.0f);
+  AUT_CHECK_EQ(tag, 7);
+  id = 1;
+  AUT_CHECK_EQ(soa.get<2>(7), 1);
+
+  return true;
+}
+
+auto test_zip() -> bool
+{
+  SoaVec<f32, f32, u32> soa;
+  for (u32 i = 0; i < 10; ++i)
+    soa.push(0.0f, static_cast<f32>(i), i);
+
+  for (auto [pos, vel] : soa.zip<0, 1>())
+    pos += vel * 2.0f;
+  AUT_CHECK_EQ(soa.get<0>(9), 18.0f);
+
+  u32 sum = 0;
+  for (auto [pos, vel, id] : soa)
+    sum += id;
+  AUT_CHECK_EQ(sum, 45);
+
+  const auto &view = soa;
+  f32 total = 0;
+  for (auto [pos] : view.zip<0>())
+    total += pos;
+  AUT_CHECK_EQ(total, 90.0f);
+
+  return true;
+}
+
+auto test_swap_remove_and_resize() -> bool
+{
+  using Entities = SoaVec<String, u32>;
+
+  Entities soa;
+  soa.push(String("first entity, long enough for the heap"), 1u);
+  soa.push(String("second"), 2u);
+  soa.push(String("third"), 3u);
+
+  soa.swap_remove(0);
+  AUT_CHECK_EQ(soa.size(), 2);
+  AUT_CHECK(soa.get<0>(0) == "third");
+  AUT_CHECK_EQ(soa.get<1>(0), 3);
+
+  soa.resize(5);
+  AUT_CHECK_EQ(soa.size(), 5);
+  AUT_CHECK(soa.get<0>(4).empty());
+  AUT_CHECK_EQ(soa.get<1>(4), 0);
+
+  Entities copy = soa;
+  soa.resize(1);
+  AUT_CHECK_EQ(copy.size(), 5);
+  AUT_CHECK(copy.get<0>(1) == "second");
+
+  Entities moved = std::move(copy);
+  AUT_CHECK(copy.empty());
+  AUT_CHECK_EQ(moved.size(), 5);
+
+  return true;
+}
+
+auto test_custom_allocator() -> bool
+{
+  using Arena = memory::ChainedArenaAllocator<>;
+  using ArenaSoa = containers::SoaVecT<memory::ArenaRef<Arena>, u32, f64>;
+
+  Arena arena(1 << 16);
+  ArenaSoa soa{memory::ArenaRef<Arena>(arena)};
+  for (u32 i = 0; i < 1000; ++i)
+    soa.push(i, static_cast<f64>(i) * 0.5);
+  AUT_CHECK_EQ(soa.get<1>(999), 499.5);
+  AUT_CHECK(arena.bytes_used() >= 1000 * (sizeof(u32) + sizeof(f64)));
+
+  return true;
+}
+
+AUT_BEGIN_TEST_LIST()
+AUT_ADD_TEST(test_push_and_columns);
+AUT_ADD_TEST(test_zip);
+AUT_ADD_TEST(test_swap_remove_and_resize);
+AUT_ADD_TEST(test_custom_allocator);
+AUT_END_TEST_LIST()
+
+AUT_END_BLOCK()
+
+AUT_REGISTER_ENTRY(containers, soa_vec);
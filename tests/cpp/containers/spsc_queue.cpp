@@ -0,0 +1,228 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/utils/test.hpp>
+#include <auxid/containers/spsc_queue.hpp>
+#include <auxid/containers/string.hpp>
+#include <auxid/memory/large_page.hpp>
+#include <auxid/thread/thread.hpp>
+
+using namespace au;
+
+AUT_BEGIN_BLOCK(containers, spsc_queue)
+
+auto test_push_pop_until_full() -> bool
+{
+  containers::SpscQueue<u32, 4> queue;
+  for (u32 i = 0; i < 4; ++i)
+    AUT_CHECK(queue.push(i));
+  AUT_CHECK_NOT(queue.push(99));
+
+  u32 value = 0;
+  AUT_CHECK(queue.pop(value));
+  AUT_CHECK_EQ(value, 0);
+
+  // The producer's cached read index is stale here and must be refreshed.
+  AUT_CHECK(queue.push(4));
+  AUT_CHECK_NOT(queue.push(5));
+
+  for (u32 i = 1; i <= 4; ++i)
+  {
+    AUT_CHECK(queue.pop(value));
+    AUT_CHECK_EQ(value, i);
+  }
+  AUT_CHECK_NOT(queue.pop(value));
+
+  return true;
+}
+
+auto test_bulk() -> bool
+{
+  containers::SpscQueue<u64, 8> queue;
+  u64 in[12];
+  for (u64 i = 0; i < 12; ++i)
+    in[i] = i * 10;
+
+  AUT_CHECK_EQ(queue.push_bulk(Span<u64>(in, 12)), 8);
+  AUT_CHECK_EQ(queue.push_bulk(Span<u64>(in + 8, 4)), 0);
+
+  u64 out[5];
+  AUT_CHECK_EQ(queue.pop_bulk(Span<u64>(out, 5)), 5);
+  AUT_CHECK_EQ(out[4], 40);
+  AUT_CHECK_EQ(queue.push_bulk(Span<u64>(in + 8, 4)), 4);
+
+  u64 rest[16];
+  AUT_CHECK_EQ(queue.pop_bulk(Span<u64>(rest, 16)), 7);
+  AUT_CHECK_EQ(rest[0], 50);
+  AUT_CHECK_EQ(rest[6], 110);
+  AUT_CHECK_EQ(queue.pop_bulk(Span<u64>(rest, 16)), 0);
+
+  return true;
+}
+
+auto test_non_trivial() -> bool
+{
+  containers::SpscQueue<String, 4> queue;
+  String in[2] = {String("a message long enough to be on the heap"), String("second")};
+  AUT_CHECK_EQ(queue.push_bulk(Span<String>(in, 2)), 2);
+  AUT_CHECK(queue.push(String("third")));
+
+  String out;
+  AUT_CHECK(queue.pop(out));
+  AUT_CHECK(out == "a message long enough to be on the heap");
+
+  // The remaining elements are destroyed with the queue.
+  return true;
+}
+
+// No default constructor, so the queue may only ever move-construct or destroy one.
+struct Ticket
+{
+  u32 id;
+  String owner;
+
+  Ticket(u32 id, String owner) : id(id), owner(std::move(owner))
+  {
+  }
+};
+
+auto test_pop_option() -> bool
+{
+  containers::SpscQueue<Ticket, 4> queue;
+  AUT_CHECK(queue.pop().is_none());
+
+  AUT_CHECK(queue.push(Ticket(1, String("an owner name long enough to be on the heap"))));
+  AUT_CHECK(queue.push(Ticket(2, String("b"))));
+  AUT_CHECK_EQ(queue.size_approx(), 2);
+
+  auto first = queue.pop();
+  AUT_CHECK(first.is_some());
+  AUT_CHECK_EQ(first->id, 1);
+  AUT_CHECK(first->owner == "an owner name long enough to be on the heap");
+
+  // The second ticket is destroyed in place with the queue.
+  return true;
+}
+
+auto test_dynamic() -> bool
+{
+  auto queue_res = containers::DynamicSpscQueue<Ticket>::create(5);
+  AUT_CHECK(queue_res.is_ok());
+  auto queue = std::move(queue_res.unwrap());
+  AUT_CHECK_EQ(queue.capacity(), 8);
+
+  for (u32 i = 0; i < 8; ++i)
+    AUT_CHECK(queue.push(Ticket(i, String("owner"))));
+  AUT_CHECK_NOT(queue.push(Ticket(8, String("owner"))));
+
+  auto ticket = queue.pop();
+  AUT_CHECK(ticket.is_some());
+  AUT_CHECK_EQ(ticket->id, 0);
+
+  // The remaining elements are destroyed with the moved-to queue.
+  auto moved = std::move(queue);
+  AUT_CHECK_EQ(moved.size_approx(), 7);
+
+  AUT_CHECK_NOT(containers::DynamicSpscQueue<Ticket>::create(0).is_ok());
+
+  return true;
+}
+
+auto test_dynamic_large_pages() -> bool
+{
+  using Queue = containers::DynamicSpscQueue<u64, memory::LargePageAllocator>;
+  // 512K slots of 8 bytes go past LARGE_PAGE_THRESHOLD, so this is one huge-page mapping
+  // (or a regular one where huge pages are unavailable).
+  auto queue = Queue::create(usize(1) << 19).unwrap();
+  AUT_CHECK_EQ(queue.capacity(), usize(1) << 19);
+
+  for (u64 i = 0; i < queue.capacity(); ++i)
+    AUT_CHECK(queue.push(i));
+  AUT_CHECK_NOT(queue.push(0));
+
+  u64 out[64];
+  AUT_CHECK_EQ(queue.pop_bulk(Span<u64>(out, 64)), 64);
+  AUT_CHECK_EQ(out[63], 63);
+
+  return true;
+}
+
+auto test_concurrent_stream() -> bool
+{
+  constexpr u64 COUNT = 200000;
+
+  containers::SpscQueue<u64, 64> queue;
+  u64 consumed_sum = 0;
+
+  const auto producer = [&queue]() {
+    u64 batch[4];
+    u64 next = 0;
+    while (next < COUNT)
+    {
+      // Alternate single and batched pushes.
+      if (next % 2 == 0)
+      {
+        if (queue.push(next + 1))
+          next++;
+        continue;
+      }
+      usize count = 0;
+      for (; count < 4 && next + count < COUNT; ++count)
+        batch[count] = next + count + 1;
+      next += queue.push_bulk(Span<u64>(batch, count));
+    }
+  };
+
+  const auto consumer = [&queue, &consumed_sum]() {
+    u64 batch[8];
+    u64 expected = 1;
+    u64 count = 0;
+    while (count < COUNT)
+    {
+      const usize n = queue.pop_bulk(Span<u64>(batch, 8));
+      for (usize i = 0; i < n; ++i)
+      {
+        if (batch[i] != expected++)
+          return;
+        consumed_sum += batch[i];
+      }
+      count += n;
+    }
+  };
+
+  auto producer_thread = Thread::create(producer).unwrap();
+  auto consumer_thread = Thread::create(consumer).unwrap();
+  producer_thread.join();
+  consumer_thread.join();
+
+  AUT_CHECK_EQ(consumed_sum, COUNT * (COUNT + 1) / 2);
+
+  return true;
+}
+
+AUT_BEGIN_TEST_LIST()
+AUT_ADD_TEST(test_push_pop_until_full);
+AUT_ADD_TEST(test_bulk);
+AUT_ADD_TEST(test_non_trivial);
+AUT_ADD_TEST(test_pop_option);
+AUT_ADD_TEST(test_dynamic);
+AUT_ADD_TEST(test_dynamic_large_pages);
+AUT_ADD_TEST(test_concurrent_stream);
+AUT_END_TEST_LIST()
+
+AUT_END_BLOCK()
+
+AUT_REGISTER_ENTRY(containers, spsc_queue);
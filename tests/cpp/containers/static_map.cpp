@@ -0,0 +1,91 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/utils/test.hpp>
+#include <auxid/containers/static_map.hpp>
+
+using namespace au;
+
+AUT_BEGIN_BLOCK(containers, static_map)
+
+using KeywordMap = StaticMap<StringView, i32>;
+using IndexMap = StaticMap<u64, u64>;
+
+auto test_keyword_table() -> bool
+{
+  const Pair<StringView, i32> keywords[] = {
+      {"if", 1}, {"else", 2}, {"while", 3}, {"for", 4}, {"return", 5}, {"break", 6}, {"continue", 7}, {"struct", 8},
+  };
+
+  auto map_res = KeywordMap::build(keywords);
+  AUT_CHECK(map_res.is_ok());
+  const auto &map = map_res.unwrap();
+
+  AUT_CHECK_EQ(map.size(), 8);
+  for (const auto &kw : keywords)
+    AUT_CHECK_EQ(*map.find(kw.first), kw.second);
+
+  AUT_CHECK_NOT(map.contains("iff"));
+  AUT_CHECK_NOT(map.contains(""));
+
+  // Transparent: probe with a slice of a larger buffer.
+  const StringView source = "  return x;";
+  AUT_CHECK_EQ(*map.find(source.substr(2, 6)), 5);
+
+  return true;
+}
+
+auto test_many_keys() -> bool
+{
+  Vec<Pair<u64, u64>> items;
+  for (u64 i = 0; i < 20000; ++i)
+    items.push({i * 0x9E3779B97F4A7C15ULL, i});
+
+  auto map_res = IndexMap::build(items);
+  AUT_CHECK(map_res.is_ok());
+  const auto &map = map_res.unwrap();
+
+  AUT_CHECK_EQ(map.size(), 20000);
+  for (const auto &item : items)
+    AUT_CHECK_EQ(*map.find(item.first), item.second);
+  for (u64 i = 1; i < 1000; ++i)
+    AUT_CHECK_NOT(map.contains(i));
+
+  auto empty_res = IndexMap::build(Span<const Pair<u64, u64>>());
+  AUT_CHECK(empty_res.is_ok());
+  AUT_CHECK_NOT(empty_res.unwrap().contains(0));
+
+  return true;
+}
+
+auto test_duplicate_keys_fail() -> bool
+{
+  const Pair<StringView, i32> keywords[] = {{"a", 1}, {"b", 2}, {"a", 3}};
+  auto map_res = KeywordMap::build(keywords);
+  AUT_CHECK(map_res.is_err());
+
+  return true;
+}
+
+AUT_BEGIN_TEST_LIST()
+AUT_ADD_TEST(test_keyword_table);
+AUT_ADD_TEST(test_many_keys);
+AUT_ADD_TEST(test_duplicate_keys_fail);
+AUT_END_TEST_LIST()
+
+AUT_END_BLOCK()
+
+AUT_REGISTER_ENTRY(containers, static_map);
@@ -0,0 +1,99 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/utils/test.hpp>
+#include <auxid/containers/static_string.hpp>
+#include <auxid/containers/hash_map.hpp>
+
+using namespace au;
+
+AUT_BEGIN_BLOCK(containers, static_string)
+
+auto test_append_and_truncate() -> bool
+{
+  StaticString<8> s = "abc";
+  AUT_CHECK_EQ(s.size(), 3);
+  AUT_CHECK(s == "abc");
+
+  AUT_CHECK(s.append("def"));
+  AUT_CHECK_NOT(s.append("ghij"));
+  AUT_CHECK(s == "abcdefgh");
+  AUT_CHECK(s.full());
+  AUT_CHECK_EQ(s.c_str()[8], '\0');
+
+  AUT_CHECK_NOT(s.push('x'));
+  s.pop();
+  AUT_CHECK(s.push('z'));
+  AUT_CHECK(s == StringView("abcdefgz"));
+
+  StaticString<4> truncated = "too long";
+  AUT_CHECK(truncated == "too ");
+
+  return true;
+}
+
+auto test_format_into_fixed_buffer() -> bool
+{
+  const auto s = StaticString<32>::format("%s=%d", "answer", 42);
+  AUT_CHECK(s == "answer=42");
+
+  StaticString<12> line;
+  AUT_CHECK(line.append_format("[%u]", 7u));
+  AUT_CHECK_NOT(line.append_format(" %s", "overflowing text"));
+  AUT_CHECK(line == "[7] overflow");
+  AUT_CHECK_EQ(line.size(), 12);
+
+  return true;
+}
+
+auto test_views_and_search() -> bool
+{
+  StaticString<32> s = "key=value";
+  AUT_CHECK_EQ(s.find('='), 3);
+  AUT_CHECK(s.substr(4) == "value");
+  AUT_CHECK_EQ(s.as_span().size(), 9);
+  AUT_CHECK_EQ(s.as_bytes()[0], 'k');
+
+  const String heap = "key=value";
+  AUT_CHECK(s == heap);
+
+  return true;
+}
+
+auto test_hash_map_key() -> bool
+{
+  using Name = StaticString<16>;
+  using NameMap = containers::HashMap<Name, u32>;
+
+  NameMap map;
+  map.insert(Name("left"), 1);
+  map.insert(Name("right"), 2);
+  AUT_CHECK_EQ(*map.find(Name("right")), 2);
+  AUT_CHECK_EQ(*map.find(StringView("left")), 1);
+
+  return true;
+}
+
+AUT_BEGIN_TEST_LIST()
+AUT_ADD_TEST(test_append_and_truncate);
+AUT_ADD_TEST(test_format_into_fixed_buffer);
+AUT_ADD_TEST(test_views_and_search);
+AUT_ADD_TEST(test_hash_map_key);
+AUT_END_TEST_LIST()
+
+AUT_END_BLOCK()
+
+AUT_REGISTER_ENTRY(containers, static_string);
@@ -0,0 +1,109 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/utils/test.hpp>
+#include <auxid/containers/static_vec.hpp>
+#include <auxid/containers/string.hpp>
+
+using namespace au;
+
+AUT_BEGIN_BLOCK(containers, static_vec)
+
+auto test_push_until_full() -> bool
+{
+  StaticVec<i32, 3> v;
+  AUT_CHECK_EQ(v.capacity(), 3);
+  AUT_CHECK(v.try_push(1));
+  v.push(2);
+  AUT_CHECK(v.try_emplace_back(3) != nullptr);
+  AUT_CHECK(v.full());
+
+  AUT_CHECK_NOT(v.try_push(4));
+  AUT_CHECK(v.try_emplace_back(4) == nullptr);
+  AUT_CHECK_EQ(v.size(), 3);
+  AUT_CHECK_EQ(v.back(), 3);
+
+  v.pop();
+  AUT_CHECK(v.try_push(5));
+  AUT_CHECK_EQ(v[2], 5);
+
+  return true;
+}
+
+auto test_resize() -> bool
+{
+  StaticVec<u32, 8> v;
+  AUT_CHECK(v.try_resize(5, 7));
+  AUT_CHECK_EQ(v.size(), 5);
+  AUT_CHECK_EQ(v[4], 7);
+
+  AUT_CHECK_NOT(v.try_resize(9));
+  AUT_CHECK_EQ(v.size(), 5);
+
+  v.resize(2);
+  AUT_CHECK_EQ(v.size(), 2);
+  AUT_CHECK_EQ(v[1], 7);
+
+  return true;
+}
+
+auto test_non_trivial_elements() -> bool
+{
+  using StringStaticVec = StaticVec<String, 4>;
+
+  StringStaticVec v = {"a string long enough to live on the heap", "b"};
+  StringStaticVec copy = v;
+  AUT_CHECK_EQ(copy.size(), 2);
+  AUT_CHECK_EQ(copy[0], "a string long enough to live on the heap");
+
+  StringStaticVec moved = std::move(v);
+  AUT_CHECK(v.empty());
+  AUT_CHECK_EQ(moved[1], "b");
+
+  moved = copy;
+  moved.emplace_back("c");
+  AUT_CHECK_EQ(moved.size(), 3);
+  AUT_CHECK_EQ(copy.size(), 2);
+
+  return true;
+}
+
+auto test_span_and_iteration() -> bool
+{
+  StaticVec<u64, 16> v = {1, 2, 3, 4};
+  Span<const u64> span = v.as_span();
+  AUT_CHECK_EQ(span.size(), 4);
+  AUT_CHECK_EQ(span.data(), v.data());
+
+  u64 sum = 0;
+  for (const u64 x : v)
+    sum += x;
+  AUT_CHECK_EQ(sum, 10);
+  AUT_CHECK_EQ(*v.rbegin(), 4);
+
+  return true;
+}
+
+AUT_BEGIN_TEST_LIST()
+AUT_ADD_TEST(test_push_until_full);
+AUT_ADD_TEST(test_resize);
+AUT_ADD_TEST(test_non_trivial_elements);
+AUT_ADD_TEST(test_span_and_iteration);
+AUT_END_TEST_LIST()
+
+AUT_END_BLOCK()
+
+AUT_REGISTER_ENTRY(containers, static_vec);
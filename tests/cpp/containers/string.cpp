@@ -15,6 +15,8 @@
 
 #include <auxid/utils/test.hpp>
 #include <auxid/containers/string.hpp>
+#include <auxid/containers/hash_map.hpp>
+#include <auxid/memory/arena.hpp>
 
 using namespace au;
 
@@ -57,11 +59,48 @@ auto test_push_pop() -> bool
   return true;
 }
 
+auto test_arena_string() -> bool
+{
+  using ArenaString = containers::StringT<memory::ArenaRef<memory::ChainedArenaAllocator<>>>;
+
+  memory::ChainedArenaAllocator<> arena;
+  {
+    ArenaString s("short", arena.ref());
+    AUT_CHECK_EQ(arena.bytes_used(), 0);
+
+    s.append(" string that no longer fits inline");
+    AUT_CHECK(arena.bytes_used() > s.size());
+    AUT_CHECK(s == "short string that no longer fits inline");
+
+    ArenaString copy = s;
+    AUT_CHECK(copy.get_allocator().arena() == &arena);
+    AUT_CHECK(copy == s);
+
+    ArenaString joined = s + "!";
+    AUT_CHECK(joined.get_allocator().arena() == &arena);
+    AUT_CHECK_EQ(joined.back(), '!');
+
+    String heap_copy = String(StringView(s));
+    AUT_CHECK(heap_copy == s);
+
+    ArenaString formatted = ArenaString::format(arena.ref(), "%s-%d", "record", 42);
+    AUT_CHECK(formatted == "record-42");
+  }
+
+  using ArenaKeyMap = containers::HashMap<ArenaString, u32>;
+  ArenaKeyMap map;
+  map[ArenaString("a key long enough to be allocated", arena.ref())] = 7;
+  AUT_CHECK_EQ(*map.find(StringView("a key long enough to be allocated")), 7);
+
+  return true;
+}
+
 AUT_BEGIN_TEST_LIST()
 AUT_ADD_TEST(test_sso);
 AUT_ADD_TEST(test_heap_allocation);
 AUT_ADD_TEST(test_append_and_concat);
 AUT_ADD_TEST(test_push_pop);
+AUT_ADD_TEST(test_arena_string);
 AUT_END_TEST_LIST()
 
 AUT_END_BLOCK()
@@ -0,0 +1,72 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/utils/test.hpp>
+#include <auxid/hash.hpp>
+#include <auxid/containers/hash_base.hpp>
+
+using namespace au;
+
+AUT_BEGIN_BLOCK(core, hash)
+
+auto test_known_vectors() -> bool
+{
+  AUT_CHECK_EQ(hash_bytes("", 0, 0), 0x93228a4de0eec5a2ULL);
+  AUT_CHECK_EQ(hash_bytes("a", 1, 1), 0xc5bac3db178713c4ULL);
+  AUT_CHECK_EQ(hash_bytes("abc", 3, 2), 0xa97f2f7b1d9b3314ULL);
+  AUT_CHECK_EQ(hash_bytes("message digest", 14, 3), 0x786d1f1df3801df4ULL);
+  AUT_CHECK_EQ(hash_bytes("abcdefghijklmnopqrstuvwxyz", 26, 4), 0xdca5a8138ad37c87ULL);
+
+  return true;
+}
+
+auto test_lengths_and_seeds() -> bool
+{
+  u8 buffer[128];
+  for (usize i = 0; i < sizeof(buffer); ++i)
+    buffer[i] = static_cast<u8>(i * 31);
+
+  // Every prefix length walks a different branch/tail combination.
+  for (usize len = 1; len < sizeof(buffer); ++len)
+  {
+    AUT_CHECK_NEQ(hash_bytes(buffer, len, 7), hash_bytes(buffer, len - 1, 7));
+    AUT_CHECK_NEQ(hash_bytes(buffer, len, 7), hash_bytes(buffer, len, 8));
+  }
+
+  return true;
+}
+
+auto test_string_hashers_agree() -> bool
+{
+  const String owned = "a string long enough to skip the small-string buffer";
+  const StringView view = owned;
+
+  AUT_CHECK_EQ(containers::Hash<String>{}(owned), containers::Hash<StringView>{}(view));
+  AUT_CHECK_EQ(containers::Hash<StringView>{}(view), containers::Hash<const char *>{}(owned.c_str()));
+  AUT_CHECK_EQ(hash_string_view(view), hash_bytes(view.data(), view.size(), hash_seed()));
+
+  return true;
+}
+
+AUT_BEGIN_TEST_LIST()
+AUT_ADD_TEST(test_known_vectors);
+AUT_ADD_TEST(test_lengths_and_seeds);
+AUT_ADD_TEST(test_string_hashers_agree);
+AUT_END_TEST_LIST()
+
+AUT_END_BLOCK()
+
+AUT_REGISTER_ENTRY(core, hash);
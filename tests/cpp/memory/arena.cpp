@@ -15,6 +15,8 @@
 
 #include <auxid/utils/test.hpp>
 #include <auxid/memory/arena.hpp>
+#include <auxid/containers/string.hpp>
+#include <auxid/containers/vec.hpp>
 
 using namespace au;
 
@@ -67,10 +69,116 @@ auto test_arena_clear() -> bool
   return true;
 }
 
+auto test_chained_arena_growth() -> bool
+{
+  memory::ChainedArenaAllocator<> arena(256);
+
+  // Far more than the first block; the Vec reallocates in place while it is the last
+  // allocation and moves to a fresh block when it is not.
+  containers::VecT<u64, usize, memory::ArenaRef<memory::ChainedArenaAllocator<>>> vec(arena.ref());
+  for (u64 i = 0; i < 10000; ++i)
+    vec.push(i);
+
+  for (u64 i = 0; i < 10000; ++i)
+    AUT_CHECK_EQ(vec[i], i);
+
+  void *big = arena.alloc(1 << 20, 64);
+  AUT_CHECK_NOT(big == nullptr);
+  AUT_CHECK_EQ(reinterpret_cast<uintptr_t>(big) % 64, 0);
+  AUT_CHECK(arena.bytes_used() >= (1 << 20) + 10000 * sizeof(u64));
+
+  return true;
+}
+
+auto test_chained_arena_in_place_realloc() -> bool
+{
+  memory::ChainedArenaAllocator<> arena(4096);
+
+  void *p = arena.alloc(64, 16);
+  const usize used = arena.bytes_used();
+  AUT_CHECK_EQ(arena.realloc(p, 64, 512, 16), p);
+  AUT_CHECK_EQ(arena.bytes_used(), used + 448);
+
+  void *q = arena.alloc(16, 16);
+  void *moved = arena.realloc(p, 512, 1024, 16);
+  AUT_CHECK_NOT(moved == p);
+
+  arena.free(q, 16, 16);
+  arena.free(moved, 1024, 16);
+  AUT_CHECK_EQ(arena.bytes_used(), used + 448 + 16);
+
+  return true;
+}
+
+// The last allocation grows in place, so even a Vec of non-trivially-copyable elements
+// keeps its buffer instead of moving every element.
+auto test_chained_arena_vec_grows_in_place() -> bool
+{
+  using Arena = memory::ChainedArenaAllocator<>;
+  using StringVec = containers::VecT<String, usize, memory::ArenaRef<Arena>>;
+
+  Arena arena(1 << 16);
+  memory::ArenaRef<Arena> ref(arena);
+
+  StringVec vec(ref);
+  vec.reserve(4);
+  const String *data = vec.data();
+  for (u32 i = 0; i < 64; ++i)
+    vec.push(String("a string too long for the inline buffer"));
+
+  AUT_CHECK_EQ(vec.data(), data);
+  AUT_CHECK_EQ(vec.size(), 64);
+  AUT_CHECK(vec[63] == StringView("a string too long for the inline buffer"));
+
+  // Anything allocated after the buffer pins it; growth falls back to a move.
+  arena.alloc(16);
+  vec.reserve(vec.capacity() * 2);
+  AUT_CHECK_NOT(vec.data() == data);
+  AUT_CHECK(vec[0] == StringView("a string too long for the inline buffer"));
+
+  return true;
+}
+
+auto test_chained_arena_markers_and_scopes() -> bool
+{
+  memory::ChainedArenaAllocator<> arena(1024);
+
+  arena.alloc(100);
+  const auto marker = arena.save_marker();
+  const usize used_at_marker = arena.bytes_used();
+
+  for (u32 i = 0; i < 100; ++i)
+    arena.alloc(200);
+  arena.rewind(marker);
+  AUT_CHECK_EQ(arena.bytes_used(), used_at_marker);
+
+  // The blocks released above are reused: a second, identical pass reserves nothing new.
+  const usize reserved = arena.bytes_reserved();
+  for (u32 round = 0; round < 3; ++round)
+  {
+    memory::ArenaScope scope(arena);
+    for (u32 i = 0; i < 100; ++i)
+      arena.alloc(200);
+  }
+  AUT_CHECK_EQ(arena.bytes_used(), used_at_marker);
+  AUT_CHECK_EQ(arena.bytes_reserved(), reserved);
+
+  arena.reset();
+  arena.trim();
+  AUT_CHECK_EQ(arena.bytes_used(), 0);
+  AUT_CHECK_EQ(arena.bytes_reserved(), 0);
+
+  return true;
+}
+
 AUT_BEGIN_TEST_LIST()
 AUT_ADD_TEST(test_arena_alloc);
 AUT_ADD_TEST(test_arena_exhaustion);
 AUT_ADD_TEST(test_arena_clear);
+AUT_ADD_TEST(test_chained_arena_growth);
+AUT_ADD_TEST(test_chained_arena_in_place_realloc);
+AUT_ADD_TEST(test_chained_arena_vec_grows_in_place);
+AUT_ADD_TEST(test_chained_arena_markers_and_scopes);
 AUT_END_TEST_LIST()
 
 AUT_END_BLOCK()
@@ -0,0 +1,90 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/utils/test.hpp>
+#include <auxid/memory/first_class_heap.hpp>
+#include <auxid/containers/vec.hpp>
+#include <auxid/containers/hash_map.hpp>
+
+using namespace au;
+
+AUT_BEGIN_BLOCK(memory, first_class_heap)
+
+auto test_heap_containers() -> bool
+{
+  memory::FirstClassHeap heap;
+  using HeapVec = containers::VecT<u64, usize, memory::FirstClassHeapAllocator>;
+  using HeapMap = containers::HashMap<u64, u64, containers::Hash<u64>, containers::EqualTo<u64>,
+                                      memory::FirstClassHeapAllocator>;
+
+  HeapVec vec(heap.allocator());
+  for (u64 i = 0; i < 10000; ++i)
+    vec.push(i * 3);
+  AUT_CHECK_EQ(vec.size(), 10000);
+  AUT_CHECK_EQ(vec[9999], 29997);
+  AUT_CHECK(vec.get_allocator().heap() == heap.heap());
+
+  void *aligned = heap.allocator().alloc(256, 128);
+  AUT_CHECK_EQ(reinterpret_cast<uintptr_t>(aligned) % 128, 0);
+  heap.allocator().free(aligned, 256, 128);
+
+  HeapMap map(heap.allocator());
+  for (u64 i = 0; i < 1000; ++i)
+    map[i] = i + 1;
+  AUT_CHECK_EQ(*map.find(999), 1000);
+  AUT_CHECK(map.get_allocator().heap() == heap.heap());
+
+  return true;
+}
+
+auto test_heap_free_all() -> bool
+{
+  memory::FirstClassHeap heap;
+  memory::FirstClassHeapAllocator allocator = heap.allocator();
+
+  for (u32 i = 0; i < 1000; ++i)
+  {
+    void *p = allocator.alloc(64 + i, 16);
+    AUT_CHECK_NOT(p == nullptr);
+  }
+
+  if constexpr (memory::FirstClassHeap::HAS_STATISTICS)
+    AUT_CHECK(heap.statistics().allocated_bytes >= 1000 * 64);
+
+  // One call drops everything; the heap is then reusable.
+  heap.free_all();
+  if constexpr (memory::FirstClassHeap::HAS_STATISTICS)
+    AUT_CHECK_EQ(heap.statistics().allocated_bytes, 0);
+
+  void *p = allocator.alloc(128);
+  AUT_CHECK_NOT(p == nullptr);
+  allocator.free(p, 128, 16);
+
+  memory::FirstClassHeap moved = std::move(heap);
+  AUT_CHECK(heap.heap() == nullptr);
+  AUT_CHECK(moved.heap() == allocator.heap());
+
+  return true;
+}
+
+AUT_BEGIN_TEST_LIST()
+AUT_ADD_TEST(test_heap_containers);
+AUT_ADD_TEST(test_heap_free_all);
+AUT_END_TEST_LIST()
+
+AUT_END_BLOCK()
+
+AUT_REGISTER_ENTRY(memory, first_class_heap);
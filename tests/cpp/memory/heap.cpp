@@ -47,9 +47,25 @@ auto test_heap_aligned_alloc() -> bool
   return true;
 }
 
+auto test_heap_expand_in_place() -> bool
+{
+  memory::HeapAllocator heap;
+  void *ptr = heap.alloc(100);
+  const usize usable = rpmalloc_usable_size(ptr);
+  AUT_CHECK(usable >= 100);
+
+  AUT_CHECK(memory::try_expand_in_place(heap, ptr, 100, usable, memory::RPMALLOC_NATURAL_ALIGN));
+  AUT_CHECK_NOT(memory::try_expand_in_place(heap, ptr, usable, usable + 4096, memory::RPMALLOC_NATURAL_ALIGN));
+  AUT_CHECK_NOT(memory::try_expand_in_place(heap, nullptr, 0, 16, memory::RPMALLOC_NATURAL_ALIGN));
+
+  heap.free(ptr, usable, memory::RPMALLOC_NATURAL_ALIGN);
+  return true;
+}
+
 AUT_BEGIN_TEST_LIST()
 AUT_ADD_TEST(test_heap_alloc_free);
 AUT_ADD_TEST(test_heap_aligned_alloc);
+AUT_ADD_TEST(test_heap_expand_in_place);
 AUT_END_TEST_LIST()
 
 AUT_END_BLOCK()
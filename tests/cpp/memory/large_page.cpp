@@ -0,0 +1,129 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/utils/test.hpp>
+#include <auxid/memory/large_page.hpp>
+#include <auxid/containers/vec.hpp>
+#include <auxid/containers/hash_map.hpp>
+
+using namespace au;
+
+AUT_BEGIN_BLOCK(memory, large_page)
+
+auto test_map_large_pages() -> bool
+{
+  memory::LargePageKind kind = memory::LargePageKind::Explicit;
+  const usize size = memory::LARGE_PAGE_SIZE + 100;
+  u8 *bytes = static_cast<u8 *>(memory::map_large_pages(size, memory::LargePageOptions{}, &kind));
+  AUT_CHECK_NOT(bytes == nullptr);
+
+  // Whatever pages the machine offered, the memory is zeroed and usable end to end.
+  AUT_CHECK_EQ(bytes[0], 0);
+  bytes[0] = 1;
+  bytes[size - 1] = 2;
+  AUT_CHECK_EQ(bytes[size - 1], 2);
+  memory::unmap_large_pages(bytes, size);
+
+  // An out-of-range node is ignored rather than failing the mapping.
+  memory::LargePageOptions options;
+  options.explicit_huge_pages = false;
+  options.numa_node = 4096;
+  void *ptr = memory::map_large_pages(memory::LARGE_PAGE_SIZE, options, &kind);
+  AUT_CHECK_NOT(ptr == nullptr);
+  AUT_CHECK_NOT(kind == memory::LargePageKind::Explicit);
+  memory::unmap_large_pages(ptr, memory::LARGE_PAGE_SIZE);
+
+  return true;
+}
+
+auto test_large_page_allocator_routing() -> bool
+{
+  memory::LargePageAllocator allocator;
+
+  void *small = allocator.alloc(256, 16);
+  AUT_CHECK(rpmalloc_usable_size(small) >= 256);
+  allocator.free(small, 256, 16);
+
+  const usize large_size = memory::LargePageAllocator::LARGE_PAGE_THRESHOLD + 4096;
+  void *large = allocator.alloc(large_size, 64);
+  AUT_CHECK_EQ(reinterpret_cast<uintptr_t>(large) % 64, 0);
+  // Growth within the rounded mapping stays put.
+  AUT_CHECK(allocator.try_expand_in_place(large, large_size, large_size + 1000, 64));
+  static_cast<u8 *>(large)[large_size + 999] = 7;
+  AUT_CHECK_NOT(allocator.try_expand_in_place(large, large_size + 1000, large_size * 2, 64));
+  allocator.free(large, large_size + 1000, 64);
+
+  return true;
+}
+
+auto test_large_page_shrink_across_threshold() -> bool
+{
+  memory::LargePageAllocator allocator;
+  const usize large_size = memory::LargePageAllocator::LARGE_PAGE_THRESHOLD;
+  const usize small_size = large_size / 2;
+
+  void *large = allocator.alloc(large_size, 64);
+  AUT_CHECK(large != nullptr);
+  static_cast<u8 *>(large)[small_size - 1] = 42;
+
+  // The shrunk block will be freed with the small size, i.e. to the heap, so it must move.
+  AUT_CHECK_NOT(allocator.try_expand_in_place(large, large_size, small_size, 64));
+  void *small = allocator.realloc(large, large_size, small_size, 64);
+  AUT_CHECK(small != nullptr);
+  AUT_CHECK(small != large);
+  AUT_CHECK_EQ(static_cast<u8 *>(small)[small_size - 1], 42);
+  AUT_CHECK(rpmalloc_usable_size(small) >= small_size);
+  allocator.free(small, small_size, 64);
+
+  return true;
+}
+
+auto test_large_page_containers() -> bool
+{
+  using LargeVec = containers::VecT<u64, usize, memory::LargePageAllocator>;
+  using LargeMap = containers::HashMap<u64, u64, containers::Hash<u64>, containers::EqualTo<u64>,
+                                       memory::LargePageAllocator>;
+
+  // Grows from the heap into page mappings and between mappings.
+  LargeVec vec;
+  for (u64 i = 0; i < 1000000; ++i)
+    vec.push(i);
+  AUT_CHECK_EQ(vec.size(), 1000000);
+  AUT_CHECK_EQ(vec[0], 0);
+  AUT_CHECK_EQ(vec[999999], 999999);
+
+  memory::LargePageOptions options;
+  options.numa_node = 0;
+  LargeMap map{memory::LargePageAllocator(options)};
+  for (u64 i = 0; i < 300000; ++i)
+    map.insert(i, i * 2);
+  AUT_CHECK_EQ(map.size(), 300000);
+  AUT_CHECK_EQ(*map.find(299999), 599998);
+  AUT_CHECK_EQ(map.get_allocator().options().numa_node, 0);
+
+  return true;
+}
+
+AUT_BEGIN_TEST_LIST()
+AUT_ADD_TEST(test_map_large_pages);
+AUT_ADD_TEST(test_large_page_allocator_routing);
+AUT_ADD_TEST(test_large_page_shrink_across_threshold);
+AUT_ADD_TEST(test_large_page_containers);
+AUT_END_TEST_LIST()
+
+AUT_END_BLOCK()
+
+AUT_REGISTER_ENTRY(memory, large_page);
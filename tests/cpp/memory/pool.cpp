@@ -0,0 +1,155 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/utils/test.hpp>
+#include <auxid/memory/pool.hpp>
+#include <auxid/containers/vec.hpp>
+#include <auxid/thread/thread.hpp>
+
+using namespace au;
+
+namespace au::memory
+{
+  struct FixedBlockPoolTestAccess
+  {
+    // Claims the next batch of indices without allocating its slab, as a thread stalled
+    // inside carve_batch would.
+    template<typename PoolT> static void claim_batch_and_stall(PoolT &pool)
+    {
+      pool.m_next_index.fetch_add(PoolT::BATCH, std::memory_order_relaxed);
+    }
+  };
+} // namespace au::memory
+
+AUT_BEGIN_BLOCK(memory, pool)
+
+auto test_pool_reuse() -> bool
+{
+  using Pool = memory::FixedBlockAllocator<24, 8>;
+  Pool pool;
+
+  void *a = pool.alloc(24, 8);
+  void *b = pool.alloc(24, 8);
+  AUT_CHECK_NOT(a == nullptr);
+  AUT_CHECK_NOT(a == b);
+  AUT_CHECK_EQ(reinterpret_cast<uintptr_t>(a) % 8, 0);
+
+  pool.free(b, 24, 8);
+  AUT_CHECK(pool.alloc(24, 8) == b);
+
+  // Requests the pool cannot serve go to the heap.
+  void *big = pool.alloc(4096, 8);
+  AUT_CHECK_NOT(big == nullptr);
+  pool.free(big, 4096, 8);
+
+  pool.free(a, 24, 8);
+  pool.free(b, 24, 8);
+  return true;
+}
+
+auto test_pool_cross_thread_free() -> bool
+{
+  using Pool = memory::FixedBlockAllocator<40, 8>;
+  constexpr usize COUNT = 4096;
+  Pool pool;
+
+  Vec<void *> ptrs;
+  for (usize i = 0; i < COUNT; ++i)
+    ptrs.push(pool.alloc(40, 8));
+  const usize reserved = Pool::pool_type::instance().blocks_reserved();
+
+  // Another thread frees everything; its cache hands the blocks back to the global list.
+  auto thread_res = Thread::create([&]() {
+    for (void *p : ptrs)
+      pool.free(p, 40, 8);
+  });
+  AUT_CHECK(thread_res.is_ok());
+  thread_res.unwrap().join();
+
+  for (usize i = 0; i < COUNT; ++i)
+    ptrs[i] = pool.alloc(40, 8);
+  AUT_CHECK_EQ(Pool::pool_type::instance().blocks_reserved(), reserved);
+
+  for (void *p : ptrs)
+    pool.free(p, 40, 8);
+  return true;
+}
+
+struct Node
+{
+  u64 key;
+  u64 value;
+  Node *next;
+
+  Node(u64 k, u64 v) : key(k), value(v), next(nullptr)
+  {
+  }
+};
+
+auto test_pool_box_and_containers() -> bool
+{
+  memory::PoolBox<Node> node = memory::make_pool_box<Node>(1, 2);
+  AUT_CHECK_EQ(node->key, 1);
+  AUT_CHECK_EQ(node->value, 2);
+
+  void *raw = node.get();
+  node.reset();
+  memory::PoolBox<Node> again = memory::make_pool_box<Node>(3, 4);
+  AUT_CHECK(again.get() == raw);
+
+  // A Vec outgrows the block size and moves over to the heap.
+  containers::VecT<u32, usize, memory::FixedBlockAllocator<64, 4>> vec;
+  for (u32 i = 0; i < 1000; ++i)
+    vec.push(i);
+  for (u32 i = 0; i < 1000; ++i)
+    AUT_CHECK_EQ(vec[i], i);
+
+  return true;
+}
+
+auto test_pool_slabs_filled_out_of_order() -> bool
+{
+  // 8 KiB blocks: slab 0 is exactly one batch, so stalling on it leaves slab 0 empty
+  // while this thread carves from slab 1.
+  using Pool = memory::FixedBlockPool<8192, 64>;
+  AUT_CHECK_EQ(Pool::instance().blocks_reserved(), 0);
+  memory::FixedBlockPoolTestAccess::claim_batch_and_stall(Pool::instance());
+
+  void *blocks[Pool::CACHE_LIMIT];
+  for (u32 i = 0; i < Pool::CACHE_LIMIT; ++i)
+    blocks[i] = Pool::alloc();
+  // Filling the thread cache hands a batch from slab 1 back to the global stack.
+  for (u32 i = 0; i < Pool::CACHE_LIMIT; ++i)
+    Pool::free(blocks[i]);
+
+  for (u32 i = 0; i < Pool::CACHE_LIMIT; ++i)
+    blocks[i] = Pool::alloc();
+  for (u32 i = 0; i < Pool::CACHE_LIMIT; ++i)
+    Pool::free(blocks[i]);
+
+  return true;
+}
+
+AUT_BEGIN_TEST_LIST()
+AUT_ADD_TEST(test_pool_reuse);
+AUT_ADD_TEST(test_pool_cross_thread_free);
+AUT_ADD_TEST(test_pool_box_and_containers);
+AUT_ADD_TEST(test_pool_slabs_filled_out_of_order);
+AUT_END_TEST_LIST()
+
+AUT_END_BLOCK()
+
+AUT_REGISTER_ENTRY(memory, pool);
@@ -0,0 +1,114 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/utils/test.hpp>
+#include <auxid/auxid.hpp>
+#include <auxid/containers/vec.hpp>
+#include <auxid/containers/hash_map.hpp>
+#include <auxid/thread/thread.hpp>
+
+using namespace au;
+
+AUT_BEGIN_BLOCK(memory, scratch)
+
+auto test_scratch_ping_pong() -> bool
+{
+  auxid::ScratchArena &first = auxid::get_thread_scratch();
+  auxid::ScratchArena &second = auxid::get_thread_scratch(&first);
+  AUT_CHECK_NOT(&first == &second);
+  AUT_CHECK(&auxid::get_thread_scratch(&second) == &first);
+  AUT_CHECK(&auxid::get_thread_scratch() == &first);
+
+  {
+    auxid::ScratchScope result_scope;
+    auxid::ScratchScope temp_scope(&result_scope.arena());
+    AUT_CHECK(&temp_scope.arena() == &second);
+
+    containers::VecT<u32, usize, memory::ArenaRef<auxid::ScratchArena>> temp(temp_scope.ref());
+    for (u32 i = 0; i < 100; ++i)
+      temp.push(i);
+    AUT_CHECK(second.bytes_used() >= 100 * sizeof(u32));
+    AUT_CHECK_EQ(first.bytes_used(), 0);
+  }
+  AUT_CHECK_EQ(second.bytes_used(), 0);
+
+  return true;
+}
+
+auto test_scratch_allocator_containers() -> bool
+{
+  using ScratchVec = containers::VecT<u64, usize, auxid::ScratchAllocator>;
+  using ScratchMap = containers::HashMap<u64, u64, containers::Hash<u64>, containers::EqualTo<u64>, auxid::ScratchAllocator>;
+
+  auxid::ScratchArena &arena = auxid::get_thread_scratch();
+  usize reserved = 0;
+  for (u32 round = 0; round < 4; ++round)
+  {
+    auxid::ScratchScope scope;
+    {
+      ScratchVec vec;
+      ScratchMap map;
+      for (u64 i = 0; i < 1000; ++i)
+      {
+        vec.push(i);
+        map[i] = i * 2;
+      }
+      AUT_CHECK_EQ(vec.size(), 1000);
+      AUT_CHECK_EQ(map.size(), 1000);
+      AUT_CHECK_EQ(*map.find(999), 1998);
+    }
+
+    // After the first round, the same blocks are reused.
+    if (round == 0)
+      reserved = arena.bytes_reserved();
+    AUT_CHECK_EQ(arena.bytes_reserved(), reserved);
+  }
+  AUT_CHECK_EQ(arena.bytes_used(), 0);
+
+  return true;
+}
+
+auto test_scratch_per_thread() -> bool
+{
+  auxid::ScratchArena *main_scratch = &auxid::get_thread_scratch();
+  auxid::ScratchArena *worker_scratch = nullptr;
+  usize worker_used = 0;
+
+  auto thread_res = Thread::create([&]() {
+    worker_scratch = &auxid::get_thread_scratch();
+    auxid::ScratchScope scope;
+    worker_scratch->alloc(256);
+    worker_used = worker_scratch->bytes_used();
+  });
+  AUT_CHECK(thread_res.is_ok());
+  thread_res.unwrap().join();
+
+  AUT_CHECK_NOT(worker_scratch == main_scratch);
+  AUT_CHECK(worker_used >= 256);
+  AUT_CHECK_EQ(main_scratch->bytes_used(), 0);
+
+  return true;
+}
+
+AUT_BEGIN_TEST_LIST()
+AUT_ADD_TEST(test_scratch_ping_pong);
+AUT_ADD_TEST(test_scratch_allocator_containers);
+AUT_ADD_TEST(test_scratch_per_thread);
+AUT_END_TEST_LIST()
+
+AUT_END_BLOCK()
+
+AUT_REGISTER_ENTRY(memory, scratch);
@@ -0,0 +1,133 @@
+// Auxid: The Orthodox C++ Platform.
+// Copyright (C) 2026 IAS (ias@iasoft.dev)
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <auxid/utils/test.hpp>
+#include <auxid/memory/tracking_allocator.hpp>
+#include <auxid/memory/arena.hpp>
+#include <auxid/containers/vec.hpp>
+#include <auxid/containers/hash_map.hpp>
+
+using namespace au;
+
+AUT_BEGIN_BLOCK(memory, stats)
+
+struct VecTag
+{
+  static constexpr const char *NAME = "test.vec";
+};
+
+struct MapTag
+{
+  static constexpr const char *NAME = "test.map";
+};
+
+struct ArenaTag
+{
+  static constexpr const char *NAME = "test.arena";
+};
+
+auto test_size_classes() -> bool
+{
+  AUT_CHECK_EQ(memory::stats_size_class_of(1), 0);
+  AUT_CHECK_EQ(memory::stats_size_class_of(16), 0);
+  AUT_CHECK_EQ(memory::stats_size_class_of(17), 1);
+  AUT_CHECK_EQ(memory::stats_size_class_of(32), 1);
+  AUT_CHECK_EQ(memory::stats_size_class_of(33), 2);
+  AUT_CHECK_EQ(memory::stats_size_class_of(usize(1) << 40), memory::STATS_SIZE_CLASS_COUNT - 1);
+  AUT_CHECK_EQ(memory::stats_size_class_limit(2), 64);
+
+  const memory::MemoryStats before = memory::stats();
+  {
+    Vec<u64> v;
+    v.reserve(100);
+  }
+  const memory::MemoryStats after = memory::stats();
+
+  if constexpr (memory::STATISTICS_ENABLED)
+  {
+    AUT_CHECK_EQ(after.total.allocs - before.total.allocs, 1);
+    AUT_CHECK_EQ(after.total.frees - before.total.frees, 1);
+    const usize cls = memory::stats_size_class_of(100 * sizeof(u64));
+    AUT_CHECK_EQ(after.size_classes[cls].allocs - before.size_classes[cls].allocs, 1);
+    AUT_CHECK_EQ(after.thread.live_bytes(), before.thread.live_bytes());
+  }
+  else
+  {
+    AUT_CHECK_EQ(after.total.allocs, 0);
+  }
+
+  return true;
+}
+
+auto test_tracking_allocator() -> bool
+{
+  using TrackedVec = containers::VecT<u32, usize, memory::TrackingAllocator<VecTag>>;
+  using TrackedMap = containers::HashMap<u32, u32, containers::Hash<u32>, containers::EqualTo<u32>,
+                                         memory::TrackingAllocator<MapTag>>;
+  using VecAlloc = memory::TrackingAllocator<VecTag>;
+  using MapAlloc = memory::TrackingAllocator<MapTag>;
+
+  {
+    TrackedVec vec;
+    for (u32 i = 0; i < 1000; ++i)
+      vec.push(i);
+    AUT_CHECK(VecAlloc::tag().counters().live_bytes() >= static_cast<i64>(1000 * sizeof(u32)));
+
+    TrackedMap map;
+    for (u32 i = 0; i < 100; ++i)
+      map[i] = i;
+    AUT_CHECK(MapAlloc::tag().counters().allocs > 0);
+    AUT_CHECK(MapAlloc::tag().counters().live_count() > 0);
+  }
+
+  // Everything went back: no leaks, and the peak is remembered.
+  AUT_CHECK_EQ(VecAlloc::tag().counters().live_bytes(), 0);
+  AUT_CHECK_EQ(MapAlloc::tag().counters().live_count(), 0);
+  AUT_CHECK(VecAlloc::tag().peak_bytes() >= 1000 * sizeof(u32));
+
+  bool found = false;
+  for (const memory::AllocationTag *tag = memory::allocation_tags(); tag; tag = tag->next())
+    found |= tag == &VecAlloc::tag();
+  AUT_CHECK(found);
+
+  return true;
+}
+
+auto test_tracking_stateful_upstream() -> bool
+{
+  using ArenaAlloc = memory::TrackingAllocator<ArenaTag, memory::ArenaRef<memory::ChainedArenaAllocator<>>>;
+  using ArenaVec = containers::VecT<u64, usize, ArenaAlloc>;
+
+  memory::ChainedArenaAllocator<> arena;
+  ArenaVec vec{ArenaAlloc(arena.ref())};
+  for (u64 i = 0; i < 500; ++i)
+    vec.push(i);
+  AUT_CHECK_EQ(vec[499], 499);
+  AUT_CHECK(ArenaAlloc::tag().counters().live_bytes() >= static_cast<i64>(500 * sizeof(u64)));
+  AUT_CHECK(arena.bytes_used() >= 500 * sizeof(u64));
+
+  return true;
+}
+
+AUT_BEGIN_TEST_LIST()
+AUT_ADD_TEST(test_size_classes);
+AUT_ADD_TEST(test_tracking_allocator);
+AUT_ADD_TEST(test_tracking_stateful_upstream);
+AUT_END_TEST_LIST()
+
+AUT_END_BLOCK()
+
+AUT_REGISTER_ENTRY(memory, stats);